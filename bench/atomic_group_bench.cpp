@@ -0,0 +1,81 @@
+#include "bench_common.hpp"
+#include "hakoniwa/pdu/bridge/policy/immediate_policy.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/*
+ * Atomic group assembly cost as the group grows: every member of an
+ * `immediate` atomic group arrives once per round, optionally from several
+ * threads, and the completing arrival resets the group. Reports the cost per
+ * arrival through the slot entry used by TransferAtomicPduGroup and through
+ * the key-based should_transfer() entry.
+ *
+ * Env: HAKO_BENCH_ROUNDS (default 2000), HAKO_BENCH_THREADS (default 4).
+ */
+using namespace hakoniwa::pdu::bridge;
+
+namespace {
+
+void run_case(size_t members, size_t threads, uint64_t rounds, bool by_key)
+{
+    ImmediatePolicy policy(true);
+    std::vector<hakoniwa::pdu::PduResolvedKey> keys;
+    std::vector<size_t> slots;
+    for (size_t i = 0; i < members; ++i) {
+        keys.push_back({"Drone", static_cast<int>(i)});
+        slots.push_back(policy.add_pdu_key(keys.back()));
+    }
+    const CycleContext ctx{};
+    std::atomic<uint64_t> completions{0};
+    // Threads stay up for all rounds; the completing arrival opens the next.
+    std::atomic<uint64_t> round{0};
+    auto arrive = [&](size_t first) {
+        for (uint64_t r = 0; r < rounds; ++r) {
+            while (round.load(std::memory_order_acquire) < r) {
+                std::this_thread::yield();
+            }
+            for (size_t i = first; i < members; i += threads) {
+                const bool ready = by_key ? policy.should_transfer(keys[i], ctx) : policy.mark_ready(slots[i]);
+                if (ready) {
+                    completions.fetch_add(1, std::memory_order_relaxed);
+                    policy.on_transferred(keys[i], ctx);
+                    round.store(r + 1, std::memory_order_release);
+                }
+            }
+        }
+    };
+    bench::Stopwatch sw;
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; ++t) {
+        workers.emplace_back(arrive, t);
+    }
+    arrive(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    const uint64_t total_ns = sw.elapsed_ns();
+    const uint64_t arrivals = rounds * members;
+
+    bench::report_begin("atomic_group", by_key ? "by_key" : "by_slot");
+    bench::report_field("members", members);
+    bench::report_field("threads", threads);
+    bench::report_field("rounds", rounds);
+    bench::report_field("completions", completions.load());
+    bench::report_field("ns_per_arrival", arrivals ? total_ns / arrivals : 0);
+    bench::report_end();
+}
+
+} // namespace
+
+int main()
+{
+    const uint64_t rounds = bench::env_u64("HAKO_BENCH_ROUNDS", 2000);
+    const size_t threads = static_cast<size_t>(bench::env_u64("HAKO_BENCH_THREADS", 4));
+    for (size_t members : {8, 64, 512}) {
+        run_case(members, 1, rounds, false);
+        run_case(members, 1, rounds, true);
+        run_case(members, threads, rounds, false);
+    }
+    return 0;
+}
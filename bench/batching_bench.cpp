@@ -0,0 +1,97 @@
+#include "bench_common.hpp"
+#include "hakoniwa/pdu/bridge/bridge_connection.hpp"
+#include "hakoniwa/pdu/bridge/bridge_core.hpp"
+#include "hakoniwa/pdu/bridge/policy/ticker_policy.hpp"
+#include "hakoniwa/pdu/bridge/transfer_pdu.hpp"
+#include "hakoniwa/pdu/endpoint.hpp"
+#include "hakoniwa/pdu/endpoint_container.hpp"
+#include "hakoniwa/time_source/time_source_factory.hpp"
+#include "hakoniwa/time_source/virtual_time_source.hpp"
+#include <vector>
+
+/*
+ * Per-cycle destination batching: a fleet of tickers that are all due every
+ * 20 ms cycle, sent one endpoint write per PDU vs. one batch frame on the
+ * Bridge.batch carrier PDU. Reports endpoint sends and trigger cost per cycle.
+ *
+ * Env: HAKO_BENCH_TRANSFERS (default 100), HAKO_BENCH_ITERATIONS (default 5000).
+ */
+using namespace hakoniwa::pdu::bridge;
+
+namespace {
+
+int run_case(bool batched, uint64_t transfers, uint64_t iterations)
+{
+    const std::string subdir = "batching";
+    auto endpoint_container = std::make_shared<hakoniwa::pdu::EndpointContainer>(
+        "node1", bench::config_path("endpoints.json", subdir));
+    if (endpoint_container->initialize() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint init failed: " << endpoint_container->last_error() << std::endl;
+        return 1;
+    }
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+
+    auto src = endpoint_container->ref("src");
+    auto dst = endpoint_container->ref("dst");
+    auto core = std::make_unique<BridgeCore>("node1", time_source, endpoint_container);
+    auto connection = std::make_unique<BridgeConnection>("node1", "fleet", false, src);
+    std::shared_ptr<PduBatch> batch;
+    if (batched) {
+        const hakoniwa::pdu::PduKey carrier{"Bridge", "batch"};
+        batch = std::make_shared<PduBatch>(
+            dst, hakoniwa::pdu::PduResolvedKey{carrier.robot, dst->get_pdu_channel_id(carrier)},
+            dst->get_pdu_size(carrier));
+        connection->add_batch(batch);
+    }
+    auto snapshot = core->source_snapshot(src);
+    const PduKey key{"pos", "Drone", "pos"};
+    for (uint64_t i = 0; i < transfers; ++i) {
+        auto transfer = std::make_unique<TransferPdu>(
+            key, std::make_shared<TickerPolicy>(20 * 1000), core->cycle_clock(), snapshot, dst);
+        transfer->set_batch(batch);
+        connection->add_transfer_pdu(std::move(transfer));
+    }
+    BridgeConnection* conn = connection.get();
+    core->add_connection(std::move(connection));
+    if (endpoint_container->start_all() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint start failed" << std::endl;
+        return 1;
+    }
+    core->start();
+
+    std::vector<std::byte> frame(src->get_pdu_size({"Drone", "pos"}), std::byte{0x11});
+    (void)src->send({"Drone", "pos"}, frame);
+
+    uint64_t bridge_ns = 0;
+    for (uint64_t i = 0; i < iterations; ++i) {
+        time_source->advance_time(20 * 1000);
+        bench::Stopwatch sw;
+        core->cyclic_trigger();
+        bridge_ns += sw.elapsed_ns();
+    }
+    const uint64_t pdus = conn->transfer_counters(core->key_registry()->find_pdu("Drone", "pos")).transfers;
+    const uint64_t sends = batched ? conn->batch_frames_sent() : pdus;
+
+    bench::report_begin("batching", batched ? "batched" : "per_pdu");
+    bench::report_field("transfers", transfers);
+    bench::report_field("iterations", iterations);
+    bench::report_field("pdus_sent", pdus);
+    bench::report_field("endpoint_sends", sends);
+    bench::report_field("sends_per_cycle", iterations ? static_cast<double>(sends) / static_cast<double>(iterations) : 0.0);
+    bench::report_field("ns_per_cycle", iterations ? bridge_ns / iterations : 0);
+    bench::report_end();
+    return 0;
+}
+
+} // namespace
+
+int main()
+{
+    const uint64_t transfers = bench::env_u64("HAKO_BENCH_TRANSFERS", 100);
+    const uint64_t iterations = bench::env_u64("HAKO_BENCH_ITERATIONS", 5000);
+    if (run_case(false, transfers, iterations) != 0) {
+        return 1;
+    }
+    return run_case(true, transfers, iterations);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+namespace hakoniwa::pdu::bridge::bench {
+
+inline std::filesystem::path bench_config_root()
+{
+    if (const char* config_dir = std::getenv("HAKO_BENCH_CONFIG_DIR"); config_dir && *config_dir) {
+        return std::filesystem::path(config_dir);
+    }
+    return std::filesystem::path(BENCH_CONFIG_DIR);
+}
+
+inline std::string config_path(const std::string& filename, const std::string& subdir)
+{
+    return (bench_config_root() / subdir / filename).string();
+}
+
+inline uint64_t env_u64(const char* name, uint64_t fallback)
+{
+    const char* value = std::getenv(name);
+    return (value && *value) ? std::strtoull(value, nullptr, 10) : fallback;
+}
+
+class Stopwatch {
+public:
+    Stopwatch() : start_(std::chrono::steady_clock::now()) {}
+    uint64_t elapsed_ns() const
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start_).count());
+    }
+
+private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+// One line per case, "key=value" separated, so results are easy to diff/grep.
+inline void report_begin(const std::string& bench, const std::string& label)
+{
+    std::cout << "[bench] " << bench << " case=" << label;
+}
+template <typename T>
+inline void report_field(const char* key, const T& value)
+{
+    std::cout << " " << key << "=" << value;
+}
+inline void report_end()
+{
+    std::cout << std::endl;
+}
+
+} // namespace hakoniwa::pdu::bridge::bench
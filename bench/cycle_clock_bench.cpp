@@ -0,0 +1,101 @@
+#include "bench_common.hpp"
+#include "hakoniwa/pdu/bridge/bridge_connection.hpp"
+#include "hakoniwa/pdu/bridge/bridge_core.hpp"
+#include "hakoniwa/pdu/bridge/policy/ticker_policy.hpp"
+#include "hakoniwa/pdu/bridge/transfer_pdu.hpp"
+#include "hakoniwa/pdu/endpoint.hpp"
+#include "hakoniwa/pdu/endpoint_container.hpp"
+#include "hakoniwa/time_source/time_source_factory.hpp"
+#include "hakoniwa/time_source/virtual_time_source.hpp"
+#include <atomic>
+#include <vector>
+
+/*
+ * Many tickers on one core: 10k TransferPdu with a 1 s ticker, so almost every
+ * cycle only evaluates policies. Reports the trigger cost and how often the
+ * time source is read per cycle (1 with the cycle clock).
+ *
+ * Env: HAKO_BENCH_TRANSFERS (default 10000), HAKO_BENCH_ITERATIONS (default 2000).
+ */
+using namespace hakoniwa::pdu::bridge;
+
+namespace {
+
+// Counts get_microseconds() calls made by the bridge.
+class CountingTimeSource final : public hakoniwa::time_source::ITimeSource {
+public:
+    explicit CountingTimeSource(std::shared_ptr<hakoniwa::time_source::ITimeSource> inner)
+        : inner_(std::move(inner)) {}
+
+    uint64_t get_microseconds() const override
+    {
+        calls_.fetch_add(1, std::memory_order_relaxed);
+        return inner_->get_microseconds();
+    }
+    uint64_t get_delta_time_microseconds() const override { return inner_->get_delta_time_microseconds(); }
+    void sleep_delta_time() override { inner_->sleep_delta_time(); }
+
+    uint64_t calls() const { return calls_.load(std::memory_order_relaxed); }
+
+private:
+    std::shared_ptr<hakoniwa::time_source::ITimeSource> inner_;
+    mutable std::atomic<uint64_t> calls_{0};
+};
+
+} // namespace
+
+int main()
+{
+    const uint64_t transfers = bench::env_u64("HAKO_BENCH_TRANSFERS", 10000);
+    const uint64_t iterations = bench::env_u64("HAKO_BENCH_ITERATIONS", 2000);
+    const std::string subdir = "ticker_scale";
+
+    auto endpoint_container = std::make_shared<hakoniwa::pdu::EndpointContainer>(
+        "node1", bench::config_path("endpoints.json", subdir));
+    if (endpoint_container->initialize() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint init failed: " << endpoint_container->last_error() << std::endl;
+        return 1;
+    }
+    auto virtual_time = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+    auto time_source = std::make_shared<CountingTimeSource>(virtual_time);
+
+    auto src = endpoint_container->ref("src");
+    auto dst = endpoint_container->ref("dst");
+    auto core = std::make_unique<BridgeCore>("node1", time_source, endpoint_container);
+    auto connection = std::make_unique<BridgeConnection>("node1", "ticker_conn", false, src);
+    auto snapshot = core->source_snapshot(src);
+    const PduKey key{"pos", "Drone", "pos"};
+    for (uint64_t i = 0; i < transfers; ++i) {
+        connection->add_transfer_pdu(std::make_unique<TransferPdu>(
+            key, std::make_shared<TickerPolicy>(1000 * 1000), core->cycle_clock(), snapshot, dst));
+    }
+    core->add_connection(std::move(connection));
+    if (endpoint_container->start_all() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint start failed" << std::endl;
+        return 1;
+    }
+    core->start();
+
+    std::vector<std::byte> frame(src->get_pdu_size({"Drone", "pos"}), std::byte{0x11});
+    (void)src->send({"Drone", "pos"}, frame);
+
+    const uint64_t calls_before = time_source->calls();
+    uint64_t bridge_ns = 0;
+    for (uint64_t i = 0; i < iterations; ++i) {
+        virtual_time->advance_time(1000);
+        bench::Stopwatch sw;
+        core->cyclic_trigger();
+        bridge_ns += sw.elapsed_ns();
+    }
+    const uint64_t calls = time_source->calls() - calls_before;
+
+    bench::report_begin("cycle_clock", "ticker_1s");
+    bench::report_field("transfers", transfers);
+    bench::report_field("iterations", iterations);
+    bench::report_field("ns_per_cycle", iterations ? bridge_ns / iterations : 0);
+    bench::report_field("time_source_calls_per_cycle",
+        iterations ? static_cast<double>(calls) / static_cast<double>(iterations) : 0.0);
+    bench::report_end();
+    return 0;
+}
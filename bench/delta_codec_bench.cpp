@@ -0,0 +1,92 @@
+#include "bench_common.hpp"
+#include "hakoniwa/pdu/bridge/delta_codec.hpp"
+#include <cstddef>
+#include <cstring>
+#include <random>
+#include <vector>
+
+/*
+ * Delta transfer vs full frames for a large PDU (default 32 KiB, the size of a
+ * visual state array) that changes a few bytes per frame. Reports bytes on the
+ * wire and encode/decode time against the full-frame copy the bridge makes
+ * without delta mode.
+ *
+ * Env: HAKO_BENCH_ITERATIONS (default 20000), HAKO_BENCH_PDU_SIZE (default 32768),
+ *      HAKO_BENCH_KEYFRAME_INTERVAL (default 30).
+ */
+using namespace hakoniwa::pdu::bridge;
+
+namespace {
+
+void run_case(const char* label, size_t pdu_size, uint64_t iterations, uint32_t keyframe_interval, size_t changes_per_frame)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> offset(0, pdu_size - 1);
+    std::vector<std::byte> frame(pdu_size);
+    for (size_t i = 0; i < pdu_size; ++i) {
+        frame[i] = std::byte(static_cast<uint8_t>(rng()));
+    }
+    std::vector<std::byte> full_copy(pdu_size);
+
+    DeltaEncoder encoder(keyframe_interval);
+    DeltaDecoder decoder;
+    uint64_t wire_bytes = 0;
+    uint64_t full_ns = 0;
+    uint64_t encode_ns = 0;
+    uint64_t decode_ns = 0;
+    uint64_t mismatches = 0;
+    for (uint64_t it = 0; it < iterations; ++it) {
+        for (size_t c = 0; c < changes_per_frame; ++c) {
+            frame[offset(rng)] ^= std::byte(0x5A);
+        }
+        {
+            bench::Stopwatch sw;
+            std::memcpy(full_copy.data(), frame.data(), pdu_size);
+            full_ns += sw.elapsed_ns();
+        }
+        bench::Stopwatch sw_encode;
+        const std::span<const std::byte> wire = encoder.encode(frame);
+        encode_ns += sw_encode.elapsed_ns();
+        wire_bytes += wire.size();
+
+        std::span<const std::byte> decoded;
+        bench::Stopwatch sw_decode;
+        const bool ok = decoder.decode(wire, decoded);
+        decode_ns += sw_decode.elapsed_ns();
+        if (!ok || decoded.size() != pdu_size || std::memcmp(decoded.data(), frame.data(), pdu_size) != 0) {
+            ++mismatches;
+        }
+    }
+
+    bench::report_begin("delta_codec", label);
+    bench::report_field("iterations", iterations);
+    bench::report_field("pdu_size", pdu_size);
+    bench::report_field("changes_per_frame", changes_per_frame);
+    bench::report_field("full_bytes", iterations * pdu_size);
+    bench::report_field("wire_bytes", wire_bytes);
+    bench::report_field("wire_vs_full", iterations ? static_cast<double>(wire_bytes) / static_cast<double>(iterations * pdu_size) : 0.0);
+    bench::report_field("keyframes", encoder.keyframes());
+    bench::report_field("full_copy_ns", iterations ? full_ns / iterations : 0);
+    bench::report_field("encode_ns", iterations ? encode_ns / iterations : 0);
+    bench::report_field("decode_ns", iterations ? decode_ns / iterations : 0);
+    bench::report_field("mismatches", mismatches);
+    bench::report_end();
+}
+
+} // namespace
+
+int main()
+{
+    const uint64_t iterations = bench::env_u64("HAKO_BENCH_ITERATIONS", 20000);
+    const size_t pdu_size = static_cast<size_t>(bench::env_u64("HAKO_BENCH_PDU_SIZE", 32768));
+    const uint32_t keyframe_interval = static_cast<uint32_t>(bench::env_u64("HAKO_BENCH_KEYFRAME_INTERVAL", 30));
+    if (pdu_size == 0) {
+        std::cerr << "HAKO_BENCH_PDU_SIZE must be > 0" << std::endl;
+        return 1;
+    }
+
+    run_case("sparse_8", pdu_size, iterations, keyframe_interval, 8);
+    run_case("sparse_64", pdu_size, iterations, keyframe_interval, 64);
+    run_case("dense_1pct", pdu_size, iterations, keyframe_interval, pdu_size / 100);
+    return 0;
+}
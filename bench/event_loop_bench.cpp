@@ -0,0 +1,242 @@
+#include "bench_common.hpp"
+#include "hakoniwa/pdu/bridge/bridge_connection.hpp"
+#include "hakoniwa/pdu/bridge/bridge_core.hpp"
+#include "hakoniwa/pdu/bridge/policy/immediate_policy.hpp"
+#include "hakoniwa/pdu/bridge/policy/ticker_policy.hpp"
+#include "hakoniwa/pdu/bridge/transfer_pdu.hpp"
+#include "hakoniwa/pdu/endpoint.hpp"
+#include "hakoniwa/pdu/endpoint_container.hpp"
+#include "hakoniwa/time_source/time_source_factory.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Daemon loop comparison on real time: the relative-sleep loop
+ * (cyclic_trigger, then sleep_delta_time), the paced loop (then
+ * sleep_until_next_period) and the event loop (then wait_next_cycle).
+ *
+ * Ticker cases forward one ticker whose interval is not a multiple of the
+ * 1 ms delta time, from a source declared "never" polled, and report how late
+ * each send goes out against its deadline. The idle ticker case uses a 100 ms
+ * ticker to show what the loop costs while nothing is due.
+ *
+ * Polled cases forward a source left on the default "auto" polling with an
+ * immediate policy, so its data only moves when the loop polls it. A
+ * publisher thread writes it every HAKO_BENCH_PUBLISH_MS; the latency is the
+ * time from each write until the loop sees it at the destination. The idle
+ * polled case publishes nothing and shows what an unused polled source costs.
+ *
+ * Every case reports wakeups per second and process CPU use.
+ *
+ * Env: HAKO_BENCH_DURATION_MS (default 2000), HAKO_BENCH_INTERVAL_US (default 2500),
+ *      HAKO_BENCH_PUBLISH_MS (default 50).
+ */
+using namespace hakoniwa::pdu::bridge;
+
+namespace {
+
+enum class Loop { Fixed, Paced, Event };
+
+struct Case {
+    std::string label;
+    Loop loop = Loop::Fixed;
+    uint64_t ticker_usec = 0;  // 0: immediate transfer from a polled source
+    uint64_t publish_usec = 0; // polled cases; 0 publishes nothing
+};
+
+// Latest write of the publisher thread: a sequence number and when it was sent.
+struct Published {
+    std::mutex mtx;
+    uint32_t sequence = 0;
+    uint64_t at_usec = 0;
+};
+
+uint64_t percentile(std::vector<uint64_t>& values, size_t pct)
+{
+    if (values.empty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    return values[(values.size() - 1) * pct / 100];
+}
+
+uint64_t mean(const std::vector<uint64_t>& values)
+{
+    uint64_t sum = 0;
+    for (uint64_t v : values) {
+        sum += v;
+    }
+    return values.empty() ? 0 : sum / values.size();
+}
+
+int run_case(const Case& c, uint64_t duration_ms)
+{
+    const std::string subdir = "ticker_scale";
+    auto endpoint_container = std::make_shared<hakoniwa::pdu::EndpointContainer>(
+        "node1", bench::config_path("endpoints.json", subdir));
+    if (endpoint_container->initialize() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint init failed: " << endpoint_container->last_error() << std::endl;
+        return 1;
+    }
+    auto time_source = hakoniwa::time_source::create_time_source("real", 1000);
+
+    const bool polled = c.ticker_usec == 0;
+    auto src = endpoint_container->ref("src");
+    auto dst = endpoint_container->ref("dst");
+    auto core = std::make_unique<BridgeCore>("node1", time_source, endpoint_container);
+    auto connection = std::make_unique<BridgeConnection>("node1", "fleet", false, src);
+    std::shared_ptr<IPduTransferPolicy> policy;
+    if (polled) {
+        policy = std::make_shared<ImmediatePolicy>(false);
+    } else {
+        policy = std::make_shared<TickerPolicy>(c.ticker_usec);
+    }
+    connection->add_transfer_pdu(std::make_unique<TransferPdu>(
+        PduKey{"pos", "Drone", "pos"}, policy, core->cycle_clock(), core->source_snapshot(src), dst));
+    const BridgeConnection* conn = connection.get();
+    core->add_connection(std::move(connection));
+    if (!polled) {
+        // The ticker reads the source itself; polling it is not what this
+        // case measures.
+        core->set_endpoint_polling("src", EndpointPolling::Never);
+    }
+    if (endpoint_container->start_all() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint start failed" << std::endl;
+        return 1;
+    }
+    core->start();
+    const PduKeyId key = core->key_registry()->find_pdu("Drone", "pos");
+    const hakoniwa::pdu::PduKey pdu_key{"Drone", "pos"};
+
+    std::vector<std::byte> frame(src->get_pdu_size(pdu_key), std::byte{0x22});
+    (void)src->send(pdu_key, frame);
+
+    Published published;
+    std::atomic<bool> publishing{polled && c.publish_usec > 0};
+    std::thread publisher;
+    if (publishing) {
+        publisher = std::thread([&]() {
+            std::vector<std::byte> data(frame.size(), std::byte{0x33});
+            uint32_t sequence = 0;
+            while (publishing.load(std::memory_order_relaxed)) {
+                std::this_thread::sleep_for(std::chrono::microseconds(c.publish_usec));
+                ++sequence;
+                std::memcpy(data.data(), &sequence, sizeof(sequence));
+                {
+                    std::lock_guard<std::mutex> lock(published.mtx);
+                    published.sequence = sequence;
+                    published.at_usec = time_source->get_microseconds();
+                }
+                (void)src->send(pdu_key, data);
+            }
+        });
+    }
+
+    std::vector<uint64_t> late_usec;    // ticker cases
+    std::vector<uint64_t> latency_usec; // polled cases
+    std::vector<std::byte> received(frame.size());
+    uint32_t seen_sequence = 0;
+    uint64_t wakeups = 0;
+    uint64_t sent = 0;
+    const std::clock_t cpu_start = std::clock();
+    const uint64_t start_usec = time_source->get_microseconds();
+    const uint64_t end_usec = start_usec + duration_ms * 1000;
+    uint64_t due_usec = kNoDeadline;
+    for (;;) {
+        const uint64_t now = time_source->get_microseconds();
+        if (now >= end_usec) {
+            break;
+        }
+        core->cyclic_trigger();
+        ++wakeups;
+        if (polled) {
+            size_t received_size = 0;
+            if (dst->recv(pdu_key, received, received_size) == HAKO_PDU_ERR_OK && received_size >= sizeof(uint32_t)) {
+                uint32_t sequence = 0;
+                std::memcpy(&sequence, received.data(), sizeof(sequence));
+                std::lock_guard<std::mutex> lock(published.mtx);
+                if (sequence != seen_sequence && sequence == published.sequence) {
+                    seen_sequence = sequence;
+                    const uint64_t seen_usec = time_source->get_microseconds();
+                    latency_usec.push_back(seen_usec > published.at_usec ? seen_usec - published.at_usec : 0);
+                }
+            }
+        } else {
+            const uint64_t transfers = conn->transfer_counters(key).transfers;
+            if (transfers != sent) {
+                sent = transfers;
+                if (due_usec != kNoDeadline && now >= due_usec) {
+                    late_usec.push_back(now - due_usec);
+                }
+            }
+            due_usec = core->next_deadline_usec();
+        }
+        switch (c.loop) {
+        case Loop::Fixed:
+            time_source->sleep_delta_time();
+            break;
+        case Loop::Paced:
+            core->sleep_until_next_period();
+            break;
+        case Loop::Event:
+            (void)core->wait_next_cycle(100 * 1000);
+            break;
+        }
+    }
+    const double cpu_sec = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+    const double wall_sec = static_cast<double>(time_source->get_microseconds() - start_usec) / 1e6;
+    publishing = false;
+    if (publisher.joinable()) {
+        publisher.join();
+    }
+
+    bench::report_begin("event_loop", c.label);
+    if (polled) {
+        bench::report_field("publish_us", c.publish_usec);
+        bench::report_field("delivered", latency_usec.size());
+        bench::report_field("latency_mean_us", mean(latency_usec));
+        bench::report_field("latency_p99_us", percentile(latency_usec, 99));
+    } else {
+        bench::report_field("interval_us", c.ticker_usec);
+        bench::report_field("sends", sent);
+        bench::report_field("late_mean_us", mean(late_usec));
+        bench::report_field("late_p99_us", percentile(late_usec, 99));
+    }
+    bench::report_field("wakeups_per_sec", wall_sec > 0 ? static_cast<uint64_t>(static_cast<double>(wakeups) / wall_sec) : 0);
+    bench::report_field("cpu_percent", wall_sec > 0 ? 100.0 * cpu_sec / wall_sec : 0.0);
+    bench::report_field("overruns", core->get_health().cycle.overruns);
+    bench::report_end();
+    return 0;
+}
+
+} // namespace
+
+int main()
+{
+    const uint64_t duration_ms = bench::env_u64("HAKO_BENCH_DURATION_MS", 2000);
+    const uint64_t interval_usec = bench::env_u64("HAKO_BENCH_INTERVAL_US", 2500);
+    const uint64_t publish_usec = bench::env_u64("HAKO_BENCH_PUBLISH_MS", 50) * 1000;
+    const std::vector<Case> cases = {
+        {"fixed", Loop::Fixed, interval_usec, 0},
+        {"paced", Loop::Paced, interval_usec, 0},
+        {"event", Loop::Event, interval_usec, 0},
+        {"fixed_idle", Loop::Fixed, 100 * 1000, 0},
+        {"event_idle", Loop::Event, 100 * 1000, 0},
+        {"fixed_polled", Loop::Fixed, 0, publish_usec},
+        {"event_polled", Loop::Event, 0, publish_usec},
+        {"fixed_polled_idle", Loop::Fixed, 0, 0},
+        {"event_polled_idle", Loop::Event, 0, 0},
+    };
+    for (const auto& c : cases) {
+        if (run_case(c, duration_ms) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
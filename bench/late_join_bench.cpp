@@ -0,0 +1,132 @@
+#include "bench_common.hpp"
+#include "hakoniwa/pdu/bridge/bridge_connection.hpp"
+#include "hakoniwa/pdu/bridge/bridge_core.hpp"
+#include "hakoniwa/pdu/bridge/destination_presence.hpp"
+#include "hakoniwa/pdu/bridge/policy/immediate_policy.hpp"
+#include "hakoniwa/pdu/bridge/policy/ticker_policy.hpp"
+#include "hakoniwa/pdu/bridge/transfer_pdu.hpp"
+#include "hakoniwa/pdu/endpoint.hpp"
+#include "hakoniwa/pdu/endpoint_container.hpp"
+#include "hakoniwa/time_source/time_source_factory.hpp"
+#include "hakoniwa/time_source/virtual_time_source.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/*
+ * Late joiner: a destination is stopped and restarted mid-run, as a viewer
+ * reconnecting to a WebSocket endpoint would be, and the bench measures the
+ * simulated time until it holds a frame again. The ticker case forwards a
+ * source updated every 10 ms on a 1 s tick; the event case forwards a source
+ * that publishes every 5 s. Each runs without and with lateJoin, on 1 ms
+ * cycles of virtual time. Before the restart a marker is written straight to
+ * the destination, so any frame the bridge delivers afterwards replaces it.
+ */
+using namespace hakoniwa::pdu::bridge;
+
+namespace {
+
+constexpr uint64_t kCycleUsec = 1000;
+constexpr uint64_t kStopAtUsec = 2400 * 1000;
+constexpr uint64_t kStartAtUsec = 2600 * 1000;
+constexpr uint64_t kGiveUpUsec = 20 * 1000 * 1000;
+constexpr std::byte kMarker{0xEE};
+
+struct CaseResult {
+    uint64_t first_frame_usec = 0; // after the restart; kGiveUpUsec if none
+    uint64_t join_cycle_ns = 0;    // trigger cost of the cycle that saw the join
+};
+
+bool run_case(bool ticker, bool late_join, CaseResult& out)
+{
+    auto endpoint_container = std::make_shared<hakoniwa::pdu::EndpointContainer>(
+        "node1", bench::config_path("endpoints.json", "ticker_scale"));
+    if (endpoint_container->initialize() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint init failed: " << endpoint_container->last_error() << std::endl;
+        return false;
+    }
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+
+    auto src = endpoint_container->ref("src");
+    auto dst = endpoint_container->ref("dst");
+    auto core = std::make_unique<BridgeCore>("node1", time_source, endpoint_container);
+    auto connection = std::make_unique<BridgeConnection>("node1", "viewer", false, src);
+    std::shared_ptr<DestinationPresence> presence;
+    if (late_join) {
+        presence = std::make_shared<DestinationPresence>("dst", dst);
+        connection->add_presence(presence);
+    }
+    std::shared_ptr<IPduTransferPolicy> policy;
+    if (ticker) {
+        policy = std::make_shared<TickerPolicy>(1000 * 1000);
+    } else {
+        policy = std::make_shared<ImmediatePolicy>(false);
+    }
+    auto transfer = std::make_unique<TransferPdu>(
+        PduKey{"pos", "Drone", "pos"}, policy, core->cycle_clock(), core->source_snapshot(src), dst);
+    transfer->set_presence(presence);
+    connection->add_transfer_pdu(std::move(transfer));
+    core->add_connection(std::move(connection));
+    if (endpoint_container->start_all() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint start failed" << std::endl;
+        return false;
+    }
+    core->start();
+
+    const hakoniwa::pdu::PduKey key{"Drone", "pos"};
+    const size_t pdu_size = src->get_pdu_size(key);
+    std::vector<std::byte> frame(pdu_size);
+    std::vector<std::byte> received(pdu_size);
+    const uint64_t publish_usec = ticker ? 10 * 1000 : 5000 * 1000;
+    uint64_t published = 0;
+    out.first_frame_usec = kGiveUpUsec;
+    for (uint64_t now = 0; now < kStartAtUsec + kGiveUpUsec; now += kCycleUsec) {
+        if (now % publish_usec == 0) {
+            std::fill(frame.begin(), frame.end(), std::byte(static_cast<uint8_t>(published++ % 200 + 1)));
+            (void)src->send(key, frame);
+        }
+        if (now == kStopAtUsec) {
+            std::fill(frame.begin(), frame.end(), kMarker);
+            (void)dst->send(key, frame);
+            (void)dst->stop();
+        }
+        if (now == kStartAtUsec) {
+            (void)dst->start();
+        }
+        bench::Stopwatch sw;
+        core->cyclic_trigger();
+        if (now == kStartAtUsec) {
+            out.join_cycle_ns = sw.elapsed_ns();
+        }
+        if (now >= kStartAtUsec) {
+            size_t received_size = 0;
+            if (dst->recv(key, received, received_size) == HAKO_PDU_ERR_OK && received_size > 0
+                && received.front() != kMarker) {
+                out.first_frame_usec = now - kStartAtUsec;
+                break;
+            }
+        }
+        time_source->advance_time(kCycleUsec);
+    }
+    return true;
+}
+
+} // namespace
+
+int main()
+{
+    for (bool ticker : {true, false}) {
+        for (bool late_join : {false, true}) {
+            CaseResult result;
+            if (!run_case(ticker, late_join, result)) {
+                return 1;
+            }
+            bench::report_begin("late_join", std::string(ticker ? "ticker_1s" : "event_5s") + (late_join ? "_late_join" : ""));
+            bench::report_field("first_frame_ms", static_cast<double>(result.first_frame_usec) / 1000.0);
+            bench::report_field("join_cycle_ns", result.join_cycle_ns);
+            bench::report_end();
+        }
+    }
+    return 0;
+}
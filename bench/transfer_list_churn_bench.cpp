@@ -0,0 +1,116 @@
+#include "bench_common.hpp"
+#include "hakoniwa/pdu/bridge/bridge_connection.hpp"
+#include "hakoniwa/pdu/bridge/bridge_core.hpp"
+#include "hakoniwa/pdu/bridge/policy/ticker_policy.hpp"
+#include "hakoniwa/pdu/bridge/transfer_pdu.hpp"
+#include "hakoniwa/pdu/endpoint.hpp"
+#include "hakoniwa/pdu/endpoint_container.hpp"
+#include "hakoniwa/time_source/time_source_factory.hpp"
+#include "hakoniwa/time_source/virtual_time_source.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/*
+ * Monitor churn against the data path: 100 tickers due every cycle while a
+ * control-plane thread attaches and detaches monitor transfers on the same
+ * connection as fast as it can. Reports the trigger cost per cycle (p50, p99,
+ * max) and the churn rate, without and with churn.
+ *
+ * Env: HAKO_BENCH_TRANSFERS (default 100), HAKO_BENCH_ITERATIONS (default 20000).
+ */
+using namespace hakoniwa::pdu::bridge;
+
+namespace {
+
+int run_case(bool churn, uint64_t transfers, uint64_t iterations)
+{
+    const std::string subdir = "ticker_scale";
+    auto endpoint_container = std::make_shared<hakoniwa::pdu::EndpointContainer>(
+        "node1", bench::config_path("endpoints.json", subdir));
+    if (endpoint_container->initialize() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint init failed: " << endpoint_container->last_error() << std::endl;
+        return 1;
+    }
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+
+    auto src = endpoint_container->ref("src");
+    auto dst = endpoint_container->ref("dst");
+    auto core = std::make_unique<BridgeCore>("node1", time_source, endpoint_container);
+    auto connection = std::make_unique<BridgeConnection>("node1", "fleet", false, src);
+    auto snapshot = core->source_snapshot(src);
+    const PduKey key{"pos", "Drone", "pos"};
+    for (uint64_t i = 0; i < transfers; ++i) {
+        connection->add_transfer_pdu(std::make_unique<TransferPdu>(
+            key, std::make_shared<TickerPolicy>(20 * 1000), core->cycle_clock(), snapshot, dst));
+    }
+    BridgeConnection* conn = connection.get();
+    core->add_connection(std::move(connection));
+    if (endpoint_container->start_all() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint start failed" << std::endl;
+        return 1;
+    }
+    core->start();
+
+    std::vector<std::byte> frame(src->get_pdu_size({"Drone", "pos"}), std::byte{0x22});
+    (void)src->send({"Drone", "pos"}, frame);
+
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> churn_ops{0};
+    std::thread churner;
+    if (churn) {
+        churner = std::thread([&]() {
+            while (!done.load(std::memory_order_relaxed)) {
+                ITransferPdu* monitor = conn->add_monitor_transfer_pdu(std::make_unique<TransferPdu>(
+                    key, std::make_shared<TickerPolicy>(20 * 1000), core->cycle_clock(), snapshot, dst));
+                monitor->set_active(false);
+                conn->remove_transfer_pdu(monitor);
+                churn_ops.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    std::vector<uint64_t> cycle_ns;
+    cycle_ns.reserve(iterations);
+    bench::Stopwatch total;
+    for (uint64_t i = 0; i < iterations; ++i) {
+        time_source->advance_time(20 * 1000);
+        bench::Stopwatch sw;
+        core->cyclic_trigger();
+        cycle_ns.push_back(sw.elapsed_ns());
+    }
+    const uint64_t total_ns = total.elapsed_ns();
+    done.store(true);
+    if (churner.joinable()) {
+        churner.join();
+    }
+    std::sort(cycle_ns.begin(), cycle_ns.end());
+    auto percentile = [&cycle_ns](double p) {
+        return cycle_ns.empty() ? 0 : cycle_ns[static_cast<size_t>(p * static_cast<double>(cycle_ns.size() - 1))];
+    };
+
+    bench::report_begin("transfer_list_churn", churn ? "churn" : "idle");
+    bench::report_field("transfers", transfers);
+    bench::report_field("iterations", iterations);
+    bench::report_field("p50_ns", percentile(0.50));
+    bench::report_field("p99_ns", percentile(0.99));
+    bench::report_field("max_ns", cycle_ns.empty() ? 0 : cycle_ns.back());
+    bench::report_field("churn_ops_per_sec", total_ns ? churn_ops.load() * 1000000000ull / total_ns : 0);
+    bench::report_field("pending_reclaim", conn->pending_reclaim());
+    bench::report_end();
+    return 0;
+}
+
+} // namespace
+
+int main()
+{
+    const uint64_t transfers = bench::env_u64("HAKO_BENCH_TRANSFERS", 100);
+    const uint64_t iterations = bench::env_u64("HAKO_BENCH_ITERATIONS", 20000);
+    if (run_case(false, transfers, iterations) != 0) {
+        return 1;
+    }
+    return run_case(true, transfers, iterations);
+}
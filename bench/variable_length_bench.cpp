@@ -0,0 +1,89 @@
+#include "bench_common.hpp"
+#include "hakoniwa/pdu/bridge/bridge_builder.hpp"
+#include "hakoniwa/pdu/bridge/bridge_core.hpp"
+#include "hakoniwa/pdu/endpoint.hpp"
+#include "hakoniwa/pdu/endpoint_container.hpp"
+#include "hakoniwa/time_source/time_source_factory.hpp"
+#include "hakoniwa/time_source/virtual_time_source.hpp"
+#include <cstddef>
+#include <random>
+#include <vector>
+
+/*
+ * Variable-length forwarding: a 64 KiB point-cloud PDU whose actual payload
+ * varies per frame. Reports bytes put on the wire by the bridge against the
+ * declared-size padding a fixed-length copy would send.
+ *
+ * Env: HAKO_BENCH_ITERATIONS (default 20000), HAKO_BENCH_MIN_PERCENT (default 5).
+ */
+using namespace hakoniwa::pdu::bridge;
+
+int main()
+{
+    const uint64_t iterations = bench::env_u64("HAKO_BENCH_ITERATIONS", 20000);
+    const uint64_t min_percent = bench::env_u64("HAKO_BENCH_MIN_PERCENT", 5);
+    const std::string subdir = "variable_length";
+
+    auto endpoint_container = std::make_shared<hakoniwa::pdu::EndpointContainer>(
+        "node1", bench::config_path("endpoints.json", subdir));
+    if (endpoint_container->initialize() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint init failed: " << endpoint_container->last_error() << std::endl;
+        return 1;
+    }
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+    auto result = build(bench::config_path("bridge.json", subdir), "node1", time_source, endpoint_container);
+    if (!result.ok()) {
+        std::cerr << "build failed: " << result.error_message << std::endl;
+        return 1;
+    }
+    auto core = std::move(result.core);
+    if (endpoint_container->start_all() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint start failed" << std::endl;
+        return 1;
+    }
+    core->start();
+
+    auto src = endpoint_container->ref("src");
+    auto dst = endpoint_container->ref("dst");
+    const hakoniwa::pdu::PduKey key{"Lidar", "points"};
+    const size_t pdu_size = src->get_pdu_size(key);
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> length(pdu_size * min_percent / 100, pdu_size);
+    std::vector<std::byte> frame(pdu_size, std::byte{0x42});
+    std::vector<std::byte> recv_buffer(pdu_size);
+
+    // Prime the ticker.
+    time_source->advance_time(1000);
+    core->cyclic_trigger();
+
+    uint64_t payload_bytes = 0;
+    uint64_t wire_bytes = 0;
+    uint64_t bridge_ns = 0;
+    for (uint64_t i = 0; i < iterations; ++i) {
+        const size_t n = length(rng);
+        payload_bytes += n;
+        (void)src->send(key, std::span<const std::byte>(frame.data(), n));
+        time_source->advance_time(1000);
+
+        bench::Stopwatch sw;
+        core->cyclic_trigger();
+        bridge_ns += sw.elapsed_ns();
+
+        size_t received_size = 0;
+        if (dst->recv(key, recv_buffer, received_size) == HAKO_PDU_ERR_OK) {
+            wire_bytes += received_size;
+        }
+    }
+
+    bench::report_begin("variable_length", "ticker_64k");
+    bench::report_field("iterations", iterations);
+    bench::report_field("payload_bytes", payload_bytes);
+    bench::report_field("wire_bytes", wire_bytes);
+    bench::report_field("padded_bytes", iterations * pdu_size);
+    bench::report_field("wire_vs_padded", iterations ? static_cast<double>(wire_bytes) / static_cast<double>(iterations * pdu_size) : 0.0);
+    bench::report_field("ns_per_cycle", iterations ? bridge_ns / iterations : 0);
+    bench::report_end();
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include "bench_common.hpp"
+#include "hakoniwa/pdu/bridge/bridge_connection.hpp"
+#include "hakoniwa/pdu/bridge/bridge_core.hpp"
+#include "hakoniwa/pdu/bridge/policy/ticker_policy.hpp"
+#include "hakoniwa/pdu/bridge/transfer_pdu.hpp"
+#include "hakoniwa/pdu/endpoint.hpp"
+#include "hakoniwa/pdu/endpoint_container.hpp"
+#include "hakoniwa/time_source/time_source_factory.hpp"
+#include "hakoniwa/time_source/virtual_time_source.hpp"
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Worker pool scaling: a fleet of connections, each with tickers on the
+ * 64 KiB point-cloud PDU due every cycle and deduplicated (so every transfer
+ * reads and hashes the payload), triggered with 1 to N threads. The uniform
+ * case gives every connection one transfer; the skewed case gives the first
+ * eighth of the connections eight, all in the first thread's range, so the
+ * other threads only keep up by stealing. Reports the trigger cost per cycle
+ * and the speedup over one thread.
+ *
+ * Env: HAKO_BENCH_CONNECTIONS (default 64), HAKO_BENCH_THREADS (default: all
+ * cores), HAKO_BENCH_ITERATIONS (default 2000).
+ */
+using namespace hakoniwa::pdu::bridge;
+
+namespace {
+
+struct CaseResult {
+    uint64_t p50_ns = 0;
+    uint64_t p99_ns = 0;
+    WorkerPoolStats pool;
+};
+
+bool run_case(bool skewed, uint64_t connections, size_t threads, uint64_t iterations, CaseResult& out)
+{
+    const std::string subdir = "variable_length";
+    auto endpoint_container = std::make_shared<hakoniwa::pdu::EndpointContainer>(
+        "node1", bench::config_path("endpoints.json", subdir));
+    if (endpoint_container->initialize() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint init failed: " << endpoint_container->last_error() << std::endl;
+        return false;
+    }
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+
+    auto src = endpoint_container->ref("src");
+    auto dst = endpoint_container->ref("dst");
+    auto core = std::make_unique<BridgeCore>("node1", time_source, endpoint_container);
+    auto snapshot = core->source_snapshot(src);
+    const PduKey key{"points", "Lidar", "points"};
+    for (uint64_t c = 0; c < connections; ++c) {
+        auto connection = std::make_unique<BridgeConnection>("node1", "fleet" + std::to_string(c), false, src);
+        const uint64_t transfers = (skewed && c < connections / 8) ? 8 : 1;
+        for (uint64_t t = 0; t < transfers; ++t) {
+            auto transfer = std::make_unique<TransferPdu>(
+                key, std::make_shared<TickerPolicy>(1000), core->cycle_clock(), snapshot, dst);
+            transfer->enable_dedupe(0);
+            connection->add_transfer_pdu(std::move(transfer));
+        }
+        core->add_connection(std::move(connection));
+    }
+    core->set_worker_pool({threads, {}});
+    if (endpoint_container->start_all() != HAKO_PDU_ERR_OK) {
+        std::cerr << "endpoint start failed" << std::endl;
+        return false;
+    }
+    core->start();
+
+    const hakoniwa::pdu::PduKey src_key{"Lidar", "points"};
+    std::vector<std::byte> frame(src->get_pdu_size(src_key), std::byte{0x42});
+    (void)src->send(src_key, frame);
+    time_source->advance_time(1000);
+    core->cyclic_trigger(); // prime the tickers
+
+    std::vector<uint64_t> cycle_ns;
+    cycle_ns.reserve(iterations);
+    for (uint64_t i = 0; i < iterations; ++i) {
+        time_source->advance_time(1000);
+        bench::Stopwatch sw;
+        core->cyclic_trigger();
+        cycle_ns.push_back(sw.elapsed_ns());
+    }
+    std::sort(cycle_ns.begin(), cycle_ns.end());
+    auto percentile = [&cycle_ns](double p) {
+        return cycle_ns.empty() ? 0 : cycle_ns[static_cast<size_t>(p * static_cast<double>(cycle_ns.size() - 1))];
+    };
+    out.p50_ns = percentile(0.50);
+    out.p99_ns = percentile(0.99);
+    out.pool = core->worker_pool_stats();
+    return true;
+}
+
+} // namespace
+
+int main()
+{
+    const uint64_t connections = bench::env_u64("HAKO_BENCH_CONNECTIONS", 64);
+    const uint64_t max_threads = std::max<uint64_t>(
+        bench::env_u64("HAKO_BENCH_THREADS", std::max(1u, std::thread::hardware_concurrency())), 1);
+    const uint64_t iterations = bench::env_u64("HAKO_BENCH_ITERATIONS", 2000);
+
+    for (bool skewed : {false, true}) {
+        uint64_t serial_ns = 0;
+        for (uint64_t threads = 1; threads <= max_threads; threads = threads < max_threads ? std::min(threads * 2, max_threads) : max_threads + 1) {
+            CaseResult result;
+            if (!run_case(skewed, connections, static_cast<size_t>(threads), iterations, result)) {
+                return 1;
+            }
+            if (threads == 1) {
+                serial_ns = result.p50_ns;
+            }
+            bench::report_begin("worker_pool_scaling", std::string(skewed ? "skewed" : "uniform") + "_t" + std::to_string(threads));
+            bench::report_field("connections", connections);
+            bench::report_field("threads", threads);
+            bench::report_field("iterations", iterations);
+            bench::report_field("p50_ns", result.p50_ns);
+            bench::report_field("p99_ns", result.p99_ns);
+            bench::report_field("speedup", result.p50_ns ? static_cast<double>(serial_ns) / static_cast<double>(result.p50_ns) : 0.0);
+            bench::report_field("steals", result.pool.steals);
+            bench::report_end();
+        }
+    }
+    return 0;
+}
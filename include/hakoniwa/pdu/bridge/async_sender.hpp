@@ -0,0 +1,222 @@
+#pragma once
+
+#include "hakoniwa/pdu/bridge/destination_backpressure.hpp"
+#include "hakoniwa/pdu/bridge/pdu_buffer.hpp"
+#include "hakoniwa/pdu/endpoint.hpp"
+#include "hakoniwa/pdu/endpoint_types.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge {
+
+// What enqueue() does when the destination queue is full.
+enum class AsyncOverflowPolicy {
+    DropOldest, // discard the oldest queued payload (default; latest data wins)
+    DropNewest, // discard the payload being enqueued
+    Block,      // wait for the sender thread to make room
+};
+
+// "dropOldest", "dropNewest" or "block"; std::nullopt for anything else.
+std::optional<AsyncOverflowPolicy> parse_async_overflow_policy(const std::string& name);
+
+inline constexpr size_t kDefaultAsyncQueueDepth = 256;
+
+struct AsyncSendSettings {
+    size_t depth = kDefaultAsyncQueueDepth; // rounded up to a power of two
+    AsyncOverflowPolicy overflow = AsyncOverflowPolicy::DropOldest;
+
+    bool operator==(const AsyncSendSettings& other) const
+    {
+        return depth == other.depth && overflow == other.overflow;
+    }
+};
+
+struct AsyncSenderStats {
+    uint64_t depth = 0;     // payloads queued right now
+    uint64_t max_depth = 0; // high-water mark of depth
+    uint64_t enqueued = 0;
+    uint64_t sent = 0;
+    uint64_t dropped = 0;     // discarded by the overflow policy
+    uint64_t send_errors = 0; // endpoint send() failures on the sender thread
+    uint64_t latency_total_ns = 0; // enqueue to send() completion, over sent
+    uint64_t latency_max_ns = 0;
+};
+
+// Shared by one producer and the sender thread. Counts the producer's
+// payloads that were queued but never reached the destination: evicted by
+// DropOldest or failed on send(). A producer that assumes the destination
+// holds what it queued (dedupe) checks it before relying on that. The sender
+// also reports each send, and each eviction as a failed send, to
+// backpressure if set (build time only).
+struct AsyncSendFeedback {
+    std::atomic<uint64_t> lost{0};
+    std::shared_ptr<DestinationBackpressure> backpressure;
+};
+
+/*
+ * Bounded lock-free ring with a sequence number per slot (Vyukov). Producers
+ * and consumers claim a position with one CAS and then work on the slot in
+ * place; the slot is handed over by publishing its sequence number. Any
+ * thread may pop, which is what lets a producer discard the oldest entry.
+ */
+template <typename T>
+class BoundedRing {
+public:
+    explicit BoundedRing(size_t min_capacity)
+    {
+        size_t capacity = 2;
+        while (capacity < min_capacity) {
+            capacity <<= 1;
+        }
+        mask_ = capacity - 1;
+        slots_ = std::make_unique<Slot[]>(capacity);
+        for (size_t i = 0; i < capacity; ++i) {
+            slots_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    size_t capacity() const { return mask_ + 1; }
+    size_t size() const
+    {
+        const size_t head = dequeue_pos_.load(std::memory_order_acquire);
+        const size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : 0;
+    }
+
+    // fill(T&) writes the claimed slot. Returns false if the ring is full.
+    template <typename Fill>
+    bool try_push(Fill&& fill)
+    {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & mask_];
+            const size_t seq = slot.seq.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    fill(slot.value);
+                    slot.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // take(T&) reads (or swaps out) the claimed slot. Returns false if empty.
+    template <typename Take>
+    bool try_pop(Take&& take)
+    {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & mask_];
+            const size_t seq = slot.seq.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    take(slot.value);
+                    slot.seq.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct alignas(kPduBufferAlignment) Slot {
+        std::atomic<size_t> seq{0};
+        T value;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_ = 0;
+    alignas(kPduBufferAlignment) std::atomic<size_t> enqueue_pos_{0};
+    alignas(kPduBufferAlignment) std::atomic<size_t> dequeue_pos_{0};
+};
+
+/*
+ * Sends to one destination endpoint from a dedicated thread, so a slow
+ * destination (e.g. a WebSocket client on a poor link) no longer stalls the
+ * cyclic trigger or the source endpoint's receive callbacks.
+ *
+ * enqueue() copies the payload into a preallocated ring slot; the sender
+ * thread swaps the slot buffer for its own spare one and sends it, so buffers
+ * circulate and steady state does not allocate. Payloads to the destination
+ * keep their enqueue order. Shared by every connection writing to the
+ * endpoint; payloads still queued when the sender is destroyed are discarded.
+ */
+class AsyncSender {
+public:
+    AsyncSender(std::shared_ptr<hakoniwa::pdu::Endpoint> dst, const AsyncSendSettings& settings);
+    ~AsyncSender();
+    AsyncSender(const AsyncSender&) = delete;
+    AsyncSender& operator=(const AsyncSender&) = delete;
+
+    // HAKO_PDU_ERR_OK once queued; HAKO_PDU_ERR_BUSY if the payload was
+    // dropped (DropNewest) or the sender is shutting down. feedback, if given,
+    // is told when the queued payload is lost later on; now_usec is the cycle
+    // time its backpressure tracker is given for the send.
+    HakoPduErrorType enqueue(const hakoniwa::pdu::PduResolvedKey& key, std::span<const std::byte> payload,
+                             const std::shared_ptr<AsyncSendFeedback>& feedback = nullptr, uint64_t now_usec = 0);
+
+    // Holds the sender thread between sends until resume(); enqueue() keeps
+    // filling the queue. Returns once the thread is parked. For tests.
+    void pause();
+    void resume();
+
+    const std::shared_ptr<hakoniwa::pdu::Endpoint>& endpoint() const { return dst_; }
+    const AsyncSendSettings& settings() const { return settings_; }
+    AsyncSenderStats stats() const;
+
+private:
+    struct Item {
+        hakoniwa::pdu::PduResolvedKey key;
+        PduBytes payload;
+        uint64_t enqueue_ns = 0;
+        std::shared_ptr<AsyncSendFeedback> feedback;
+        uint64_t now_usec = 0;
+        bool probe = false; // queued while the destination was congested
+    };
+
+    void run_();
+    bool push_(const hakoniwa::pdu::PduResolvedKey& key, std::span<const std::byte> payload, uint64_t now_ns,
+               const std::shared_ptr<AsyncSendFeedback>& feedback, uint64_t now_usec, bool probe);
+    void wake_sender_();
+
+    std::shared_ptr<hakoniwa::pdu::Endpoint> dst_;
+    AsyncSendSettings settings_;
+    BoundedRing<Item> ring_;
+    std::atomic<bool> stopping_{false};
+    std::atomic<bool> sender_waiting_{false};
+    std::atomic<bool> paused_{false};
+    std::atomic<bool> parked_{false};
+    std::atomic<uint32_t> wake_seq_{0};
+    std::atomic<uint64_t> max_depth_{0};
+    std::atomic<uint64_t> enqueued_{0};
+    std::atomic<uint64_t> sent_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> send_errors_{0};
+    std::atomic<uint64_t> latency_total_ns_{0};
+    std::atomic<uint64_t> latency_max_ns_{0};
+    std::thread thread_;
+};
+
+} // namespace hakoniwa::pdu::bridge
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace hakoniwa::pdu::bridge {
+
+// Priority class of a transfer; lower values are served first.
+enum class TransferPriority : uint8_t {
+    High = 0,   // never held back by a budget (commands)
+    Normal = 1, // deferred to the next cycle when the budget is exhausted
+    Low = 2,    // dropped when the budget is exhausted (bulk data)
+};
+
+// "high", "normal" or "low"; std::nullopt for anything else.
+std::optional<TransferPriority> parse_transfer_priority(const std::string& name);
+
+enum class BudgetDecision {
+    Send,
+    Defer,
+    Drop,
+};
+
+struct BudgetStats {
+    uint64_t bytes_per_sec = 0;
+    uint64_t sent_bytes = 0;     // bytes admitted
+    uint64_t allowance_bytes = 0; // burst plus refill over the observed period
+    uint64_t deferred = 0;
+    uint64_t dropped = 0;
+};
+
+/*
+ * Token bucket shared by every transfer a connection sends to one destination.
+ * Holds up to burst_bytes and refills at bytes_per_sec, measured against the
+ * CycleContext time passed in. High priority sends are always admitted and may
+ * overdraw the bucket by up to one burst, which then holds lower classes back
+ * until it has refilled. Budgets count payload bytes before compression.
+ */
+class BandwidthBudget {
+public:
+    BandwidthBudget(uint64_t bytes_per_sec, uint64_t burst_bytes);
+
+    // can_defer is true on the cyclic path, where a deferred transfer is
+    // retried on the next cycle; elsewhere Normal is dropped like Low.
+    BudgetDecision admit(uint64_t now_usec, size_t bytes, TransferPriority priority, bool can_defer);
+
+    BudgetStats stats() const;
+
+private:
+    void refill_(uint64_t now_usec);
+
+    const uint64_t bytes_per_sec_;
+    const int64_t burst_ubytes_; // byte-microseconds, so refill stays integral
+    mutable std::mutex mtx_;
+    int64_t tokens_ubytes_;
+    bool started_ = false;
+    uint64_t first_usec_ = 0;
+    uint64_t last_usec_ = 0;
+    uint64_t sent_bytes_ = 0;
+    uint64_t deferred_ = 0;
+    uint64_t dropped_ = 0;
+};
+
+} // namespace hakoniwa::pdu::bridge
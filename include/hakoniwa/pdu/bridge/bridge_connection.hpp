@@ -2,7 +2,10 @@
 
 #include "hakoniwa/pdu/bridge/transfer_pdu.hpp"
 #include "hakoniwa/pdu/endpoint.hpp"
-#include "hakoniwa/time_source/time_source.hpp" // Include for ITimeSource
+#include "hakoniwa/pdu/bridge/cycle_clock.hpp"
+#include "hakoniwa/pdu/bridge/destination_presence.hpp"
+#include "hakoniwa/pdu/bridge/epoch_domain.hpp"
+#include "hakoniwa/pdu/bridge/transfer_scheduler.hpp"
 #include <vector>
 #include <memory>
 #include <chrono>
@@ -10,9 +13,21 @@
 #include <cstdint>
 #include <atomic>
 #include <mutex>
+#include <utility>
 
 namespace hakoniwa::pdu::bridge {
 
+/*
+ * The transfers of a connection, together with its batches, budgets, senders
+ * and backpressure trackers, are published as an immutable snapshot behind an
+ * atomic pointer. cyclic_trigger() and the stats getters read it without
+ * taking any lock shared with the control plane. Adding or removing a
+ * transfer copies it, swaps the pointer and retires the old snapshot (and any
+ * removed transfer) to an EpochDomain. Retired objects are freed by the next
+ * write or trigger after no reader can still see them. set_active() and
+ * increment_epoch() leave the snapshot alone: under the writer lock they only
+ * store per-transfer atomics, which a running trigger may observe mid-cycle.
+ */
 class BridgeConnection {
 public:
     // Backward-compatible constructor.
@@ -25,30 +40,112 @@ public:
                      const std::string& connection_id,
                      bool epoch_validation,
                      std::shared_ptr<hakoniwa::pdu::Endpoint> src_endpoint)
-        : node_id_(node_id), connection_id_(connection_id), src_endpoint_(std::move(src_endpoint)), epoch_validation_(epoch_validation) {}
+        : node_id_(node_id), connection_id_(connection_id), src_endpoint_(std::move(src_endpoint)), epoch_validation_(epoch_validation)
+    {
+        list_.store(list_owner_.get(), std::memory_order_seq_cst);
+    }
+    ~BridgeConnection();
+    BridgeConnection(const BridgeConnection&) = delete;
+    BridgeConnection& operator=(const BridgeConnection&) = delete;
 
     const std::string& getNodeId() const { return node_id_; }
     const std::string& getConnectionId() const { return connection_id_; }
 
     void add_transfer_pdu(std::unique_ptr<ITransferPdu> pdu);
     ITransferPdu* add_monitor_transfer_pdu(std::unique_ptr<ITransferPdu> pdu);
+    // Deactivates transfer and unpublishes it; it is destroyed once no
+    // cyclic_trigger() in progress can still reach it.
     bool remove_transfer_pdu(ITransferPdu* transfer);
     void set_active(bool is_active);
-    bool is_active() const { return is_active_; }
+    bool is_active() const { return is_active_.load(std::memory_order_acquire); }
     uint8_t get_epoch() const { return epoch_.load(std::memory_order_relaxed); }
     void increment_epoch();
     bool epoch_validation_enabled() const { return epoch_validation_; }
     std::shared_ptr<hakoniwa::pdu::Endpoint> get_source_endpoint() const { return src_endpoint_; }
 
-    void cyclic_trigger();
+    // Runs only the transfers whose deadline has been reached. Meant for one
+    // triggering thread at a time; concurrent calls are serialised.
+    void cyclic_trigger(const CycleContext& ctx);
+    // Earliest deadline of the connection's cyclic transfers; kNoDeadline if
+    // none are queued or the connection is paused.
+    uint64_t next_deadline_usec() const;
+    // Counters of every transfer forwarding key, summed over destinations. The
+    // key is interned in the registry of the connection's source snapshot.
+    TransferCounters transfer_counters(const PduKeyId& key) const;
+    // Batches are flushed at the end of every cyclic_trigger(); the transfers
+    // that append to them are configured with TransferPdu::set_batch().
+    void add_batch(std::shared_ptr<PduBatch> batch);
+    bool has_batches() const;
+    // Batch frames sent and PDUs carried by them, over all destinations.
+    uint64_t batch_frames_sent() const;
+    uint64_t batch_records_sent() const;
+    // Per-destination bandwidth budgets; the transfers charging them are
+    // configured with TransferPdu::set_budget().
+    void add_budget(std::shared_ptr<BandwidthBudget> budget);
+    bool has_budgets() const;
+    // Stats of every budget, summed over destinations.
+    BudgetStats budget_stats() const;
+    // Sender threads of the connection's async destinations (may be shared
+    // with other connections writing to the same endpoint).
+    void add_async_sender(std::shared_ptr<AsyncSender> sender);
+    bool has_async_senders() const;
+    // Stats of every sender, summed over destinations.
+    AsyncSenderStats async_sender_stats() const;
+    // Congestion trackers of the connection's destinations. When one of them
+    // recovers, cyclic_trigger() flushes the values the transfers held back.
+    void add_backpressure(std::shared_ptr<DestinationBackpressure> backpressure);
+    bool has_backpressure() const;
+    // Stats per destination, keyed by destination endpoint id.
+    std::vector<std::pair<std::string, BackpressureStats>> backpressure_stats() const;
+    // Late-joiner watchers of the connection's destinations. cyclic_trigger()
+    // polls them first; on a join the transfers resend their latest values
+    // before this cycle's due transfers run.
+    void add_presence(std::shared_ptr<DestinationPresence> presence);
+    bool has_presence() const;
+    // Stats of every watcher, summed over destinations.
+    PresenceStats presence_stats() const;
+    // Snapshots and removed transfers not yet freed (for tests and benches).
+    size_t pending_reclaim() const { return reclaim_.pending(); }
 
 private:
+    struct TransferList {
+        std::vector<ScheduledTransfer> transfers;
+        std::vector<std::shared_ptr<PduBatch>> batches;
+        std::vector<std::shared_ptr<BandwidthBudget>> budgets;
+        std::vector<std::shared_ptr<AsyncSender>> async_senders;
+        std::vector<std::shared_ptr<DestinationBackpressure>> backpressures;
+        std::vector<std::shared_ptr<DestinationPresence>> presences;
+        uint64_t version = 0;
+    };
+
+    // Copies the current list, applies edit and publishes the copy. Caller
+    // holds writer_mtx_.
+    template <typename Edit>
+    void update_list_(Edit&& edit);
+    // cyclic_trigger() body, run pinned to the current list.
+    void run_due_(const CycleContext& ctx);
+    // Brings scheduler_ in line with list and with deadlines moved by events.
+    // Caller holds trigger_mtx_.
+    void sync_scheduler_(const TransferList& list) const;
+
     std::string node_id_;
     std::string connection_id_;
     std::shared_ptr<hakoniwa::pdu::Endpoint> src_endpoint_;
-    mutable std::mutex transfer_mtx_;
+    mutable EpochDomain reclaim_;
+    std::atomic<const TransferList*> list_{nullptr};
+    // Writers: owns the transfers and the current list, never taken by readers.
+    mutable std::mutex writer_mtx_;
     std::vector<std::unique_ptr<ITransferPdu>> transfer_pdus_;
-    bool is_active_ = true;
+    std::shared_ptr<const TransferList> list_owner_ = std::make_shared<TransferList>();
+    uint64_t next_seq_ = 0;
+    // Serialises the users of scheduler_ (cyclic_trigger, next_deadline_usec);
+    // the control plane never takes it.
+    mutable std::mutex trigger_mtx_;
+    mutable TransferScheduler scheduler_;
+    mutable uint64_t scheduled_version_ = 0;
+    // Raised by transfers whose deadline moved outside cyclic_trigger().
+    mutable std::atomic<bool> deadlines_changed_{false};
+    std::atomic<bool> is_active_{true};
     std::atomic<uint8_t> epoch_{0};
     bool epoch_validation_ = false;
 };
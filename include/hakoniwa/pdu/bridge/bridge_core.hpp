@@ -1,9 +1,17 @@
 #pragma once
 
+#include "hakoniwa/pdu/bridge/async_sender.hpp"
 #include "hakoniwa/pdu/bridge/bridge_connection.hpp"
 #include "hakoniwa/pdu/bridge/bridge_monitor_core.hpp"
 #include "hakoniwa/pdu/bridge/bridge_types.hpp"
+#include "hakoniwa/pdu/bridge/cycle_clock.hpp"
+#include "hakoniwa/pdu/bridge/cycle_timing.hpp"
+#include "hakoniwa/pdu/bridge/cycle_wakeup.hpp"
+#include "hakoniwa/pdu/bridge/cycle_worker_pool.hpp"
+#include "hakoniwa/pdu/bridge/endpoint_poller.hpp"
+#include "hakoniwa/pdu/bridge/key_registry.hpp"
 #include "hakoniwa/pdu/bridge/pdu_transfer_policy.hpp"
+#include "hakoniwa/pdu/bridge/source_snapshot.hpp"
 #include "hakoniwa/pdu/endpoint_container.hpp"
 #include "hakoniwa/time_source/time_source.hpp" // Include for ITimeSource
 #include <vector>
@@ -34,6 +42,48 @@ public:
         return time_source_->get_delta_time_microseconds();
     }
 
+    // Clock shared by every transfer of this core. The time source is read once
+    // per cyclic_trigger() and the resulting CycleContext is passed down.
+    const std::shared_ptr<CycleClock>& cycle_clock() const { return cycle_clock_; }
+    // Live (default) keeps reading the time source for receive-event callbacks;
+    // Cycle makes them reuse the timestamp of the last cycle.
+    void set_event_clock_mode(EventClockMode mode) { cycle_clock_->set_event_clock_mode(mode); }
+
+    // Intern table for the robot, PDU and connection names of this core; every
+    // snapshot it creates (and so every transfer) shares it.
+    const std::shared_ptr<KeyRegistry>& key_registry() const { return keys_; }
+
+    // Returns the read-once snapshot of a source endpoint, creating it on first use.
+    // Every transfer reading from the same endpoint must share this snapshot.
+    std::shared_ptr<SourceSnapshot> source_snapshot(const std::shared_ptr<hakoniwa::pdu::Endpoint>& endpoint);
+    // Returns the sender thread of a destination endpoint, creating it on
+    // first use. Every transfer writing asynchronously to the endpoint shares
+    // it, so all must ask for the same settings; nullptr and error otherwise.
+    std::shared_ptr<AsyncSender> async_sender(
+        const std::shared_ptr<hakoniwa::pdu::Endpoint>& endpoint,
+        const AsyncSendSettings& settings,
+        std::string& error);
+
+    // Which endpoints cyclic_trigger() polls for receive events; see
+    // endpoint_poller.hpp. By default only endpoints the bridge reads from
+    // are polled, every cycle (with idle back-off once wait_next_cycle() is
+    // in use).
+    bool set_endpoint_polling(const std::string& endpoint_id, EndpointPolling mode)
+    {
+        return poller_.set_mode(endpoint_id, mode);
+    }
+    // min_interval_usec defaults to the time source's delta time.
+    void set_polling_settings(PollingSettings settings);
+    std::vector<EndpointPollStats> endpoint_poll_stats() const { return poller_.stats(); }
+
+    // Spreads the connections of each cyclic_trigger() over settings.threads
+    // threads (the triggering thread included), with work stealing between
+    // them; cyclic_trigger() still returns only after every connection has
+    // run. threads <= 1 (the default) keeps the serial loop. Must not be
+    // called concurrently with cyclic_trigger().
+    void set_worker_pool(const WorkerPoolSettings& settings);
+    WorkerPoolStats worker_pool_stats() const;
+
     void start();
 
     bool is_running() const override
@@ -50,6 +100,36 @@ public:
      */
     bool cyclic_trigger();
 
+    /*
+     * Earliest time-source value (usec) at which a cyclic transfer or an
+     * endpoint poll becomes due, or kNoDeadline if neither is pending. Loops
+     * may sleep until then; endpoints that are not polled deliver receive
+     * events independently of it.
+     */
+    uint64_t next_deadline_usec() const;
+
+    /*
+     * Sleeps until the next cycle should run, for an event-driven loop in
+     * place of ITimeSource::sleep_delta_time(): until next_deadline_usec()
+     * (one delta time if something is due every cycle), a wakeup()
+     * notification, or max_wait_usec (kNoDeadline: no cap), whichever comes
+     * first. Returns true if woken by a notification. The first call puts the
+     * endpoint poller in event-loop mode, so endpoints without recent receive
+     * events back off instead of holding the loop to one delta time.
+     */
+    bool wait_next_cycle(uint64_t max_wait_usec);
+    /*
+     * Fixed-period pacing in place of ITimeSource::sleep_delta_time(): sleeps
+     * until the next boundary of a schedule advancing by the time source's
+     * delta time, so processing time does not stretch the period. A loop
+     * that has fallen behind restarts the schedule instead of bursting.
+     * Cycle time, overruns and start jitter are reported by get_health().
+     */
+    void sleep_until_next_period() { timing_.sleep_until_next_period(); }
+    // Notified by receive events on every source snapshot, monitor transfer
+    // attach, connection resume and stop(). Others may notify it too.
+    const std::shared_ptr<CycleWakeup>& wakeup() const { return wakeup_; }
+
     // Stops the execution loop. This can be called from a different thread.
     void stop();
 
@@ -92,21 +172,33 @@ private:
         BridgeConnection* connection,
         const std::vector<MonitorFilter>& filters,
         std::string& error) const;
-    const std::vector<std::pair<std::string, std::string>>* find_transferable_pdus_(
-        const std::string& connection_id) const;
+    const std::vector<PduKeyId>* find_transferable_pdus_(const std::string& connection_id) const;
+    std::shared_ptr<SourceSnapshot> find_source_snapshot_(
+        const std::shared_ptr<hakoniwa::pdu::Endpoint>& endpoint) const;
 
     std::string node_name_;
+    std::shared_ptr<KeyRegistry> keys_;
+    std::shared_ptr<CycleWakeup> wakeup_;
     std::vector<std::unique_ptr<BridgeConnection>> connections_;
+    std::unordered_map<NameId, size_t> connection_index_; // interned id -> connections_
     std::atomic<bool> is_running_;
     std::shared_ptr<hakoniwa::time_source::ITimeSource> time_source_;
+    std::shared_ptr<CycleClock> cycle_clock_;
     std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container_;
+    CycleTiming timing_;
     std::vector<std::string> endpoint_ids_;
+    EndpointPoller poller_;
+    std::unique_ptr<CycleWorkerPool> workers_; // null: serial
     mutable std::mutex state_mtx_;
     std::string last_error_;
     uint64_t started_time_usec_{0};
-    std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>> connection_transferable_pdus_;
+    std::unordered_map<NameId, std::vector<PduKeyId>> connection_transferable_pdus_;
     mutable std::mutex monitor_runtime_mtx_;
     std::shared_ptr<BridgeMonitorRuntime> monitor_runtime_;
+    mutable std::mutex source_snapshots_mtx_;
+    std::vector<std::shared_ptr<SourceSnapshot>> source_snapshots_;
+    std::mutex async_senders_mtx_;
+    std::vector<std::shared_ptr<AsyncSender>> async_senders_;
 };
 
 } // namespace hakoniwa::pdu::bridge
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <map>
@@ -19,6 +21,17 @@ struct TransferPolicy {
     std::string type;
     std::optional<int> intervalMs;
     std::optional<bool> atomic;
+    std::optional<bool> trailing;    // throttle only: send the newest suppressed event when the window closes
+    std::optional<bool> phaseSpread; // ticker only: stagger instances across the interval
+    std::optional<bool> fixedRate;   // ticker only: anchor ticks to an absolute schedule
+    std::optional<std::string> catchUp; // fixedRate only: "skip" (default) or "burst"
+    std::optional<int> maxBurst;     // catchUp "burst": most owed ticks kept
+    std::optional<bool> onlyIfUpdated; // ticker only: skip ticks without a new receive event
+    std::optional<bool> dedupe;      // any policy: skip byte-identical payloads
+    std::optional<int> dedupeRefreshMs; // dedupe: force a resend after this long
+    std::optional<std::string> delta; // non-atomic: "encode" or "decode" keyframe/delta frames
+    std::optional<int> deltaKeyframeInterval; // delta "encode": frames per keyframe
+    std::optional<std::string> priority; // "high", "normal" (default) or "low"
 };
 
 // from nodes
@@ -39,18 +52,48 @@ struct PduKey {
     std::string pdu_name;
 };
 
+// from connections / destinations
+struct CompressionConfig {
+    std::string algorithm;       // "none", "lz4" or "zstd"
+    std::optional<int> level;    // algorithm specific; default when omitted
+    std::optional<int> minBytes; // payloads below this are sent raw
+};
+
+struct BandwidthConfig {
+    int64_t bytesPerSec = 0;
+    std::optional<int64_t> burstBytes; // default: 100 ms worth of bytesPerSec
+};
+
+struct AsyncSendConfig {
+    std::optional<int> depth;            // queue slots; default 256
+    std::optional<std::string> overflow; // "dropOldest" (default), "dropNewest" or "block"
+};
+
+struct BackpressureConfig {
+    std::optional<int> slowSendUsec;    // a slower send marks congestion; default: failures only
+    std::optional<int> probeIntervalMs; // while congested; default 100
+};
+
 // from connections
 struct ConnectionSource {
     std::string endpointId;
+    std::optional<bool> decompress; // peer bridge compresses payloads to this source
+    std::optional<bool> unbatch;    // peer bridge sends batch frames to this source
 };
 
 struct ConnectionDestination {
     std::string endpointId;
+    std::optional<CompressionConfig> compression; // overrides Connection::compression
+    std::optional<BandwidthConfig> bandwidth;     // overrides Connection::bandwidth
+    std::optional<AsyncSendConfig> async;         // send from a per-endpoint thread
+    std::optional<BackpressureConfig> backpressure; // overrides Connection::backpressure
+    std::optional<bool> lateJoin; // overrides Connection::lateJoin
 };
 
 struct TransferPduConfig {
     std::string pduKeyGroupId;
     std::string policyId;
+    std::optional<std::string> priority; // overrides TransferPolicy::priority
 };
 
 struct Connection {
@@ -60,6 +103,24 @@ struct Connection {
     std::vector<ConnectionDestination> destinations;
     std::vector<TransferPduConfig> transferPdus;
     std::optional<bool> epoch_validation;
+    std::optional<CompressionConfig> compression; // default for every destination
+    std::optional<PduKey> batch; // carrier PDU for per-cycle batch frames (id unused)
+    std::optional<BandwidthConfig> bandwidth; // per-destination budget default
+    std::optional<BackpressureConfig> backpressure; // per-destination congestion default
+    std::optional<bool> lateJoin; // replay latest values to destinations that start running
+};
+
+// from polling
+struct PollingConfig {
+    std::optional<int> idleAfterMs;   // back off idle endpoints; default: never (10 in the event loop)
+    std::optional<int> maxIntervalMs; // longest gap between idle polls; default 100 (10 in the event loop)
+    std::map<std::string, std::string> endpoints; // endpoint id -> "auto" | "always" | "never"
+};
+
+// from workers
+struct WorkersConfig {
+    std::optional<int> threads;   // including the triggering thread; default 1 (serial)
+    std::vector<int> cpuAffinity; // CPU per pool thread; entry 0 is the triggering thread
 };
 
 // Root Configuration Object
@@ -68,6 +129,8 @@ struct BridgeConfig {
     std::map<std::string, TransferPolicy> transferPolicies;
     std::vector<Node> nodes;
     std::optional<std::string> endpoints_config_path;
+    std::optional<PollingConfig> polling;
+    std::optional<WorkersConfig> workers;
     std::vector<WireLink> wireLinks;
     std::map<std::string, std::vector<PduKey>> pduKeyGroups;
     std::vector<Connection> connections;
@@ -107,10 +170,36 @@ struct MonitorSessionInfo {
     MonitorSessionState state = MonitorSessionState::Created;
 };
 
+// Cycle-time histogram: bucket i counts cycles shorter than
+// kCycleHistogramBaseUsec << i; the last bucket is open-ended.
+inline constexpr uint64_t kCycleHistogramBaseUsec = 16;
+inline constexpr size_t kCycleHistogramBuckets = 18;
+
+// Processing time of BridgeCore::cyclic_trigger(), on the steady clock.
+struct CycleTimingDto {
+    uint64_t period_usec = 0;     // delta time of the time source
+    uint64_t cycles = 0;
+    uint64_t overruns = 0;        // cycles longer than period_usec
+    uint64_t mean_cycle_usec = 0;
+    uint64_t max_cycle_usec = 0;
+    uint64_t max_jitter_usec = 0; // late cycle starts; measured only when paced by sleep_until_next_period()
+    std::vector<uint64_t> histogram; // kCycleHistogramBuckets entries
+};
+
 struct BridgeHealthDto {
     bool running = false;
     uint64_t uptime_usec = 0;
     std::string last_error;
+    CycleTimingDto cycle;
+};
+
+struct DestinationStateDto {
+    std::string endpoint_id;
+    bool congested = false;
+    uint64_t congestion_events = 0;
+    uint64_t recoveries = 0;
+    uint64_t coalesced_drops = 0; // held-back values replaced by newer ones
+    uint64_t flushed = 0;         // held-back values sent on recovery
 };
 
 struct ConnectionStateDto {
@@ -119,6 +208,22 @@ struct ConnectionStateDto {
     bool active = false;
     uint8_t epoch = 0;
     bool epoch_validation = false;
+    std::optional<uint64_t> batch_frames; // batching connections only
+    std::optional<uint64_t> batched_pdus; // PDUs carried by those frames
+    std::optional<uint64_t> budget_bytes_per_sec; // budgeted connections only, all destinations
+    std::optional<uint64_t> budget_sent_bytes;    // bytes admitted by the budgets
+    std::optional<double> budget_utilization;     // sent / allowance so far
+    std::optional<uint64_t> budget_deferred;      // Normal sends pushed to a later cycle
+    std::optional<uint64_t> budget_dropped;       // sends dropped for lack of budget
+    std::optional<uint64_t> async_queue_depth;     // async destinations only, summed
+    std::optional<uint64_t> async_queue_max_depth; // high-water mark, summed
+    std::optional<uint64_t> async_sent;
+    std::optional<uint64_t> async_dropped;         // overflow policy drops
+    std::optional<uint64_t> async_latency_avg_usec; // enqueue to send completion
+    std::optional<uint64_t> async_latency_max_usec;
+    std::optional<uint64_t> late_joins;        // lateJoin destinations only, summed
+    std::optional<uint64_t> late_join_replays; // latest values resent on those joins
+    std::vector<DestinationStateDto> destinations; // destinations with backpressure only
 };
 
 struct PduStateDto {
@@ -126,6 +231,18 @@ struct PduStateDto {
     std::string robot;
     std::string pdu_name;
     std::optional<int> channel_id;
+    std::optional<uint64_t> pdu_size;          // declared (maximum) size
+    std::optional<uint64_t> max_received_size; // high-water mark of actual payloads
+    std::optional<uint64_t> transfers;         // payloads sent, all destinations
+    std::optional<uint64_t> missed_ticks;      // fixed-rate ticks dropped
+    std::optional<uint64_t> unchanged_skips;   // onlyIfUpdated ticks with nothing new
+    std::optional<uint64_t> dedupe_suppressed; // identical payloads not resent
+    std::optional<uint64_t> trailing_sends;    // trailing throttle window-close sends
+    std::optional<uint64_t> compressed_in_bytes;  // bytes entering the compression stage
+    std::optional<uint64_t> compressed_out_bytes; // bytes it put on the wire
+    std::optional<uint64_t> compress_errors;      // codec failures sent raw instead
+    std::optional<uint64_t> compress_usec;        // time spent compressing
+    std::optional<uint64_t> decompress_usec;      // time spent decompressing received payloads
 };
 
 // JSON parsing helpers for BridgeConfig DTOs (moved from bridge_loader.cpp)
@@ -137,6 +254,39 @@ inline void from_json(const nlohmann::json& j, TransferPolicy& p) {
     if (j.contains("atomic")) {
         p.atomic = j.at("atomic").get<bool>();
     }
+    if (j.contains("phaseSpread")) {
+        p.phaseSpread = j.at("phaseSpread").get<bool>();
+    }
+    if (j.contains("fixedRate")) {
+        p.fixedRate = j.at("fixedRate").get<bool>();
+    }
+    if (j.contains("catchUp")) {
+        p.catchUp = j.at("catchUp").get<std::string>();
+    }
+    if (j.contains("maxBurst")) {
+        p.maxBurst = j.at("maxBurst").get<int>();
+    }
+    if (j.contains("onlyIfUpdated")) {
+        p.onlyIfUpdated = j.at("onlyIfUpdated").get<bool>();
+    }
+    if (j.contains("trailing")) {
+        p.trailing = j.at("trailing").get<bool>();
+    }
+    if (j.contains("dedupe")) {
+        p.dedupe = j.at("dedupe").get<bool>();
+    }
+    if (j.contains("dedupeRefreshMs")) {
+        p.dedupeRefreshMs = j.at("dedupeRefreshMs").get<int>();
+    }
+    if (j.contains("delta")) {
+        p.delta = j.at("delta").get<std::string>();
+    }
+    if (j.contains("deltaKeyframeInterval")) {
+        p.deltaKeyframeInterval = j.at("deltaKeyframeInterval").get<int>();
+    }
+    if (j.contains("priority")) {
+        p.priority = j.at("priority").get<std::string>();
+    }
 }
 inline void from_json(const nlohmann::json& j, Node& n) {
     j.at("id").get_to(n.id);
@@ -150,15 +300,70 @@ inline void from_json(const nlohmann::json& j, PduKey& p) {
     j.at("robot_name").get_to(p.robot_name);
     j.at("pdu_name").get_to(p.pdu_name);
 }
+inline void from_json(const nlohmann::json& j, CompressionConfig& c) {
+    j.at("algorithm").get_to(c.algorithm);
+    if (j.contains("level")) {
+        c.level = j.at("level").get<int>();
+    }
+    if (j.contains("minBytes")) {
+        c.minBytes = j.at("minBytes").get<int>();
+    }
+}
+inline void from_json(const nlohmann::json& j, BandwidthConfig& b) {
+    j.at("bytesPerSec").get_to(b.bytesPerSec);
+    if (j.contains("burstBytes")) {
+        b.burstBytes = j.at("burstBytes").get<int64_t>();
+    }
+}
+inline void from_json(const nlohmann::json& j, AsyncSendConfig& a) {
+    if (j.contains("depth")) {
+        a.depth = j.at("depth").get<int>();
+    }
+    if (j.contains("overflow")) {
+        a.overflow = j.at("overflow").get<std::string>();
+    }
+}
+inline void from_json(const nlohmann::json& j, BackpressureConfig& b) {
+    if (j.contains("slowSendUsec")) {
+        b.slowSendUsec = j.at("slowSendUsec").get<int>();
+    }
+    if (j.contains("probeIntervalMs")) {
+        b.probeIntervalMs = j.at("probeIntervalMs").get<int>();
+    }
+}
 inline void from_json(const nlohmann::json& j, ConnectionSource& s) {
     j.at("endpointId").get_to(s.endpointId);
+    if (j.contains("decompress")) {
+        s.decompress = j.at("decompress").get<bool>();
+    }
+    if (j.contains("unbatch")) {
+        s.unbatch = j.at("unbatch").get<bool>();
+    }
 }
 inline void from_json(const nlohmann::json& j, ConnectionDestination& d) {
     j.at("endpointId").get_to(d.endpointId);
+    if (j.contains("compression")) {
+        d.compression = j.at("compression").get<CompressionConfig>();
+    }
+    if (j.contains("bandwidth")) {
+        d.bandwidth = j.at("bandwidth").get<BandwidthConfig>();
+    }
+    if (j.contains("async")) {
+        d.async = j.at("async").get<AsyncSendConfig>();
+    }
+    if (j.contains("backpressure")) {
+        d.backpressure = j.at("backpressure").get<BackpressureConfig>();
+    }
+    if (j.contains("lateJoin")) {
+        d.lateJoin = j.at("lateJoin").get<bool>();
+    }
 }
 inline void from_json(const nlohmann::json& j, TransferPduConfig& t) {
     j.at("pduKeyGroupId").get_to(t.pduKeyGroupId);
     j.at("policyId").get_to(t.policyId);
+    if (j.contains("priority")) {
+        t.priority = j.at("priority").get<std::string>();
+    }
 }
 inline void from_json(const nlohmann::json& j, Connection& c) {
     j.at("id").get_to(c.id);
@@ -169,6 +374,44 @@ inline void from_json(const nlohmann::json& j, Connection& c) {
     if (j.contains("epoch_validation")) {
         c.epoch_validation = j.at("epoch_validation").get<bool>();
     }
+    if (j.contains("compression")) {
+        c.compression = j.at("compression").get<CompressionConfig>();
+    }
+    if (j.contains("batch")) {
+        const auto& batch = j.at("batch");
+        PduKey carrier;
+        batch.at("robot_name").get_to(carrier.robot_name);
+        batch.at("pdu_name").get_to(carrier.pdu_name);
+        c.batch = carrier;
+    }
+    if (j.contains("bandwidth")) {
+        c.bandwidth = j.at("bandwidth").get<BandwidthConfig>();
+    }
+    if (j.contains("backpressure")) {
+        c.backpressure = j.at("backpressure").get<BackpressureConfig>();
+    }
+    if (j.contains("lateJoin")) {
+        c.lateJoin = j.at("lateJoin").get<bool>();
+    }
+}
+inline void from_json(const nlohmann::json& j, PollingConfig& p) {
+    if (j.contains("idleAfterMs")) {
+        p.idleAfterMs = j.at("idleAfterMs").get<int>();
+    }
+    if (j.contains("maxIntervalMs")) {
+        p.maxIntervalMs = j.at("maxIntervalMs").get<int>();
+    }
+    if (j.contains("endpoints")) {
+        j.at("endpoints").get_to(p.endpoints);
+    }
+}
+inline void from_json(const nlohmann::json& j, WorkersConfig& w) {
+    if (j.contains("threads")) {
+        w.threads = j.at("threads").get<int>();
+    }
+    if (j.contains("cpuAffinity")) {
+        j.at("cpuAffinity").get_to(w.cpuAffinity);
+    }
 }
 inline void from_json(const nlohmann::json& j, BridgeConfig& b) {
     j.at("version").get_to(b.version);
@@ -177,6 +420,12 @@ inline void from_json(const nlohmann::json& j, BridgeConfig& b) {
     if (j.contains("endpoints_config_path")) {
         b.endpoints_config_path = j.at("endpoints_config_path").get<std::string>();
     }
+    if (j.contains("polling")) {
+        b.polling = j.at("polling").get<PollingConfig>();
+    }
+    if (j.contains("workers")) {
+        b.workers = j.at("workers").get<WorkersConfig>();
+    }
     if (j.contains("wireLinks")) {
         j.at("wireLinks").get_to(b.wireLinks);
     }
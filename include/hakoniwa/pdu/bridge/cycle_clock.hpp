@@ -0,0 +1,71 @@
+#pragma once
+
+#include "hakoniwa/time_source/time_source.hpp"
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+namespace hakoniwa::pdu::bridge {
+
+// Time and sequence number of one bridge trigger. Captured once and passed by
+// reference to every connection, transfer and policy evaluated in that trigger.
+struct CycleContext {
+    uint64_t now_usec = 0;
+    uint64_t cycle = 0;
+};
+
+// Deadline value meaning "never due on the cyclic path".
+inline constexpr uint64_t kNoDeadline = std::numeric_limits<uint64_t>::max();
+
+// How receive-event callbacks (outside cyclic_trigger()) obtain their time.
+enum class EventClockMode {
+    Live,  // read the time source per event (exact event time; default)
+    Cycle, // reuse the timestamp of the last cycle (no time source call)
+};
+
+/*
+ * Owns the bridge time source and hands out CycleContexts. BridgeCore calls
+ * begin_cycle() once per trigger; transfers call event_context() from receive
+ * callbacks. Both may run on different threads.
+ */
+class CycleClock {
+public:
+    explicit CycleClock(std::shared_ptr<hakoniwa::time_source::ITimeSource> time_source)
+        : time_source_(std::move(time_source)) {}
+
+    CycleContext begin_cycle()
+    {
+        CycleContext ctx;
+        ctx.now_usec = time_source_ ? time_source_->get_microseconds() : 0;
+        ctx.cycle = cycle_.fetch_add(1, std::memory_order_acq_rel) + 1;
+        now_usec_.store(ctx.now_usec, std::memory_order_release);
+        return ctx;
+    }
+
+    CycleContext event_context() const
+    {
+        CycleContext ctx;
+        ctx.cycle = cycle_.load(std::memory_order_acquire);
+        if (mode_.load(std::memory_order_relaxed) == EventClockMode::Cycle || !time_source_) {
+            ctx.now_usec = now_usec_.load(std::memory_order_acquire);
+        }
+        else {
+            ctx.now_usec = time_source_->get_microseconds();
+        }
+        return ctx;
+    }
+
+    void set_event_clock_mode(EventClockMode mode) { mode_.store(mode, std::memory_order_relaxed); }
+    EventClockMode event_clock_mode() const { return mode_.load(std::memory_order_relaxed); }
+
+    const std::shared_ptr<hakoniwa::time_source::ITimeSource>& time_source() const { return time_source_; }
+
+private:
+    std::shared_ptr<hakoniwa::time_source::ITimeSource> time_source_;
+    std::atomic<uint64_t> now_usec_{0};
+    std::atomic<uint64_t> cycle_{0};
+    std::atomic<EventClockMode> mode_{EventClockMode::Live};
+};
+
+} // namespace hakoniwa::pdu::bridge
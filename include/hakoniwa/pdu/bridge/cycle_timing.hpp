@@ -0,0 +1,53 @@
+#pragma once
+
+#include "hakoniwa/pdu/bridge/bridge_types.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace hakoniwa::pdu::bridge {
+
+/*
+ * Cycle-time statistics and absolute-deadline pacing for BridgeCore.
+ *
+ * begin()/end() bracket every cyclic_trigger(). sleep_until_next_period()
+ * sleeps until the next period boundary of a fixed schedule (previous
+ * boundary + period), so the processing time of a cycle does not add to
+ * its period. A loop that is already past the boundary restarts the
+ * schedule from now rather than running the missed periods back to back;
+ * those cycles show up as overruns. Jitter is how late a cycle starts
+ * against its boundary and is only measured while the loop is paced.
+ *
+ * With a period of 0 nothing counts as an overrun and pacing does not sleep.
+ */
+class CycleTiming {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit CycleTiming(uint64_t period_usec = 0) : period_usec_(period_usec) {}
+
+    void begin(Clock::time_point start);
+    void end(Clock::time_point finish);
+    void sleep_until_next_period();
+
+    CycleTimingDto stats() const;
+
+private:
+    static size_t bucket_(uint64_t cycle_usec);
+
+    mutable std::mutex mtx_;
+    const uint64_t period_usec_;
+    Clock::time_point start_{};
+    bool started_ = false;
+    Clock::time_point boundary_{}; // start of the current period when paced
+    bool paced_ = false;           // boundary_ applies to the next begin()
+    uint64_t cycles_ = 0;
+    uint64_t overruns_ = 0;
+    uint64_t total_usec_ = 0;
+    uint64_t max_cycle_usec_ = 0;
+    uint64_t max_jitter_usec_ = 0;
+    std::array<uint64_t, kCycleHistogramBuckets> histogram_{};
+};
+
+} // namespace hakoniwa::pdu::bridge
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace hakoniwa::pdu::bridge {
+
+/*
+ * Wakes a loop sleeping between BridgeCore cycles.
+ *
+ * notify() may be called from any thread, receive callbacks included. Only
+ * the first notify() after a wait takes the lock, so a burst of events costs
+ * one lock and one condition-variable signal. A notification sent while
+ * nobody waits is kept and ends the next wait at once.
+ */
+class CycleWakeup {
+public:
+    void notify();
+    // Drops a pending notification; the next wait sleeps its full timeout.
+    void clear() { pending_.store(false, std::memory_order_release); }
+
+    // Blocks for up to timeout_usec (kNoDeadline: until notified). True if a
+    // notification ended the wait, or was already pending; it is consumed.
+    bool wait_for_usec(uint64_t timeout_usec);
+
+    uint64_t notifications() const { return notifications_.load(std::memory_order_relaxed); }
+
+private:
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::atomic<bool> pending_{false};
+    std::atomic<uint64_t> notifications_{0};
+};
+
+} // namespace hakoniwa::pdu::bridge
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge {
+
+struct WorkerPoolSettings {
+    size_t threads = 1; // including the triggering thread; 1 = serial
+    // CPU of each pool thread, cycled if shorter than threads. Entry 0 is the
+    // triggering thread, which the pool does not pin; empty = no pinning.
+    std::vector<int> cpu_affinity;
+};
+
+struct WorkerPoolStats {
+    size_t threads = 1;
+    uint64_t runs = 0;   // run() calls
+    uint64_t tasks = 0;  // tasks executed over all runs
+    uint64_t steals = 0; // tasks executed by a thread other than their owner
+};
+
+/*
+ * Fork-join pool for the per-cycle work of BridgeCore::cyclic_trigger().
+ *
+ * run() splits the task indices into one contiguous range per thread, the
+ * calling thread included. Each thread drains its own range and then steals
+ * the remaining indices of the others, so one slow task does not hold up the
+ * tasks queued behind it. run() returns only after every task has finished,
+ * which is the end-of-cycle barrier.
+ *
+ * run() is meant for one thread at a time; the workers sleep between runs.
+ */
+class CycleWorkerPool {
+public:
+    explicit CycleWorkerPool(WorkerPoolSettings settings);
+    ~CycleWorkerPool();
+    CycleWorkerPool(const CycleWorkerPool&) = delete;
+    CycleWorkerPool& operator=(const CycleWorkerPool&) = delete;
+
+    size_t threads() const { return ranges_.size(); }
+
+    // Calls task(i) once for every i in [0, task_count) and waits for all.
+    void run(size_t task_count, const std::function<void(size_t)>& task);
+
+    WorkerPoolStats stats() const;
+
+private:
+    // Next unclaimed index of one thread's range; owner and thieves claim
+    // with fetch_add, so an index past end only means the range is empty.
+    struct alignas(64) Range {
+        std::atomic<size_t> next{0};
+        size_t end = 0;
+    };
+
+    void worker_main_(size_t self);
+    void work_(size_t self);
+
+    WorkerPoolSettings settings_;
+    std::vector<Range> ranges_;
+    std::vector<std::thread> workers_;
+
+    std::mutex mtx_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    uint64_t generation_ = 0; // bumped by run() to start the workers
+    size_t busy_workers_ = 0;
+    bool stopping_ = false;
+    const std::function<void(size_t)>* task_ = nullptr;
+
+    std::atomic<uint64_t> runs_{0};
+    std::atomic<uint64_t> tasks_{0};
+    std::atomic<uint64_t> steals_{0};
+};
+
+} // namespace hakoniwa::pdu::bridge
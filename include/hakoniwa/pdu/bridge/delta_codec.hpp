@@ -0,0 +1,83 @@
+#pragma once
+
+#include "hakoniwa/pdu/bridge/pdu_buffer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace hakoniwa::pdu::bridge {
+
+/*
+ * Keyframe + delta encoding for large PDUs that change a few bytes per frame.
+ *
+ * Keyframes go on the wire unmodified, so a receiver without a decoder still
+ * sees valid PDUs on keyframe boundaries. A delta frame is
+ *
+ *   DeltaHeader | { varint equal_run, varint literal_len, literal bytes }*
+ *
+ * where the runs describe the frame relative to the last keyframe (bytes past
+ * the keyframe's end compare against zero). Every delta names its keyframe by
+ * content hash, so a receiver that missed the keyframe drops deltas until the
+ * next one instead of rebuilding garbage. Deltas never depend on each other.
+ * Keyframes are told apart by the absence of the header magic; Hakoniwa PDUs
+ * start with their own metadata header, so they cannot be mistaken for one.
+ */
+struct DeltaHeader {
+    static constexpr uint32_t kMagic = 0x314C4448; // "HDL1"
+    uint32_t magic;
+    uint32_t full_size;       // decoded payload size
+    uint64_t keyframe_hash;   // hash_pdu_bytes() of the base keyframe
+};
+static_assert(sizeof(DeltaHeader) == 16, "DeltaHeader is a wire format");
+
+class DeltaEncoder {
+public:
+    // A keyframe is sent at least every keyframe_interval frames (>= 1).
+    explicit DeltaEncoder(uint32_t keyframe_interval);
+
+    // Returns the bytes to send for frame. The span refers either to frame
+    // itself (keyframe) or to an internal buffer valid until the next call.
+    std::span<const std::byte> encode(std::span<const std::byte> frame);
+
+    // Makes the next frame a keyframe, for a receiver that has none yet.
+    void force_keyframe() { has_keyframe_ = false; }
+
+    uint64_t keyframes() const { return keyframes_; }
+    uint64_t deltas() const { return deltas_; }
+
+private:
+    // Appends the delta of frame against keyframe_ to out_; returns false as
+    // soon as it would not be smaller than limit bytes.
+    bool build_delta_(std::span<const std::byte> frame, size_t limit);
+
+    uint32_t keyframe_interval_;
+    uint32_t since_keyframe_ = 0;
+    bool has_keyframe_ = false;
+    uint64_t keyframe_hash_ = 0;
+    PduBytes keyframe_;
+    PduBytes out_;
+    uint64_t keyframes_ = 0;
+    uint64_t deltas_ = 0;
+};
+
+class DeltaDecoder {
+public:
+    // Rebuilds the full frame from wire bytes. On success out refers either to
+    // wire itself (keyframe) or to an internal buffer valid until the next
+    // call. Returns false for a delta whose keyframe is unknown or corrupt.
+    bool decode(std::span<const std::byte> wire, std::span<const std::byte>& out);
+
+    uint64_t dropped() const { return dropped_; }
+
+private:
+    bool has_keyframe_ = false;
+    uint64_t keyframe_hash_ = 0;
+    PduBytes keyframe_;
+    PduBytes out_;
+    uint64_t dropped_ = 0;
+};
+
+// True if the bytes carry a DeltaHeader (and are therefore not a keyframe).
+bool is_delta_frame(std::span<const std::byte> wire);
+
+} // namespace hakoniwa::pdu::bridge
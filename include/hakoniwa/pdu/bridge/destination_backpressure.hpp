@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace hakoniwa::pdu::bridge {
+
+inline constexpr uint64_t kDefaultBackpressureProbeUsec = 100 * 1000;
+
+struct BackpressureSettings {
+    uint64_t slow_send_usec = 0; // a send taking longer counts as congestion; 0 = failures only
+    uint64_t probe_interval_usec = kDefaultBackpressureProbeUsec;
+};
+
+struct BackpressureStats {
+    bool congested = false;
+    uint64_t congestion_events = 0; // healthy -> congested transitions
+    uint64_t recoveries = 0;        // congested -> healthy transitions
+    uint64_t coalesced_drops = 0;   // pending values superseded by newer ones
+    uint64_t flushed = 0;           // pending values sent after recovery
+};
+
+/*
+ * Congestion state of one destination of a connection, shared by the
+ * transfers writing to it. A failed or slow send marks the destination
+ * congested; transfers then hold only their newest value instead of sending
+ * (cyclic transfers skip the source read altogether). One send per probe
+ * interval is let through to test the link, and the first one that succeeds
+ * in time marks the destination recovered so the connection flushes what is
+ * pending. Probe timing uses CycleContext time; send duration is wall time.
+ */
+class DestinationBackpressure {
+public:
+    DestinationBackpressure(std::string endpoint_id, const BackpressureSettings& settings)
+        : endpoint_id_(std::move(endpoint_id)), settings_(settings) {}
+
+    const std::string& endpoint_id() const { return endpoint_id_; }
+    const BackpressureSettings& settings() const { return settings_; }
+    bool congested() const { return congested_.load(std::memory_order_acquire); }
+
+    // True if a send may go out now: always while healthy, once per probe
+    // interval while congested. False means the caller should coalesce.
+    bool admit(uint64_t now_usec);
+    // Reports the outcome of a send admitted above.
+    void on_send(uint64_t now_usec, bool ok, uint64_t send_usec);
+
+    // True once after each recovery; the connection then flushes its transfers.
+    bool take_recovered() { return recovered_.exchange(false, std::memory_order_acq_rel); }
+    bool recovery_pending() const { return recovered_.load(std::memory_order_acquire); }
+
+    void note_coalesced(bool superseded)
+    {
+        if (superseded) {
+            coalesced_drops_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    void note_flushed() { flushed_.fetch_add(1, std::memory_order_relaxed); }
+
+    BackpressureStats stats() const;
+
+private:
+    const std::string endpoint_id_;
+    const BackpressureSettings settings_;
+    std::atomic<bool> congested_{false};
+    std::atomic<bool> recovered_{false};
+    mutable std::mutex mtx_; // guards the transitions and probe schedule
+    uint64_t next_probe_usec_ = 0;
+    uint64_t congestion_events_ = 0;
+    uint64_t recoveries_ = 0;
+    std::atomic<uint64_t> coalesced_drops_{0};
+    std::atomic<uint64_t> flushed_{0};
+};
+
+} // namespace hakoniwa::pdu::bridge
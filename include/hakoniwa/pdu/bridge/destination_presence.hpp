@@ -0,0 +1,53 @@
+#pragma once
+
+#include "hakoniwa/pdu/endpoint.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace hakoniwa::pdu::bridge {
+
+struct PresenceStats {
+    bool running = false;
+    uint64_t joins = 0;   // not running -> running transitions
+    uint64_t replays = 0; // latest values resent to the destination on a join
+};
+
+/*
+ * Watches one destination of a connection for late joiners, such as a viewer
+ * connecting to a WebSocket endpoint after the bridge started.
+ *
+ * The connection calls poll() once per cycle; it reads the endpoint's
+ * is_running() and counts every not-running -> running transition as a join.
+ * Transfers that keep their latest value (TransferPdu::set_presence()) resend
+ * it once per join, so the newcomer gets a complete frame without waiting for
+ * the next event or tick. The first poll only records the state: a
+ * destination already running when the bridge starts has nothing to catch up.
+ */
+class DestinationPresence {
+public:
+    DestinationPresence(std::string endpoint_id, std::shared_ptr<hakoniwa::pdu::Endpoint> endpoint)
+        : endpoint_id_(std::move(endpoint_id)), endpoint_(std::move(endpoint)) {}
+
+    const std::string& endpoint_id() const { return endpoint_id_; }
+
+    // True if the destination joined since the last poll. Triggering thread only.
+    bool poll();
+    // Joins seen so far; a transfer replays whenever this moves on.
+    uint64_t joins() const { return joins_.load(std::memory_order_acquire); }
+    void note_replayed() { replays_.fetch_add(1, std::memory_order_relaxed); }
+
+    PresenceStats stats() const;
+
+private:
+    const std::string endpoint_id_;
+    const std::shared_ptr<hakoniwa::pdu::Endpoint> endpoint_;
+    bool polled_ = false;
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> joins_{0};
+    std::atomic<uint64_t> replays_{0};
+};
+
+} // namespace hakoniwa::pdu::bridge
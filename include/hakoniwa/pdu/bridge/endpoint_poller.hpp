@@ -0,0 +1,109 @@
+#pragma once
+
+#include "hakoniwa/pdu/bridge/cycle_clock.hpp"
+#include "hakoniwa/pdu/bridge/source_snapshot.hpp"
+#include "hakoniwa/pdu/endpoint.hpp"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge {
+
+enum class EndpointPolling {
+    Auto,   // poll while the bridge reads from the endpoint, with idle back-off
+    Always, // poll every cycle, subscribed or not
+    Never,  // the endpoint delivers receive events on its own threads
+};
+
+std::optional<EndpointPolling> parse_endpoint_polling(const std::string& name);
+const char* to_string(EndpointPolling mode);
+
+struct PollingSettings {
+    uint64_t idle_after_usec = 0;   // back off after this long without events; 0 = never
+    uint64_t max_interval_usec = 0; // longest gap between polls while idle; 0 = default
+    uint64_t min_interval_usec = 0; // first gap once idle (the core uses its cycle time)
+};
+
+inline constexpr uint64_t kDefaultMaxPollIntervalUsec = 100 * 1000;
+// Back-off applied in event-loop mode when idle_after_usec is unset. Polled
+// data then waits at most this long after an idle spell, and an idle bridge
+// wakes about a hundred times a second rather than every cycle.
+inline constexpr uint64_t kEventLoopIdleAfterUsec = 10 * 1000;
+inline constexpr uint64_t kEventLoopMaxPollIntervalUsec = 10 * 1000;
+
+struct EndpointPollStats {
+    std::string endpoint_id;
+    EndpointPolling mode = EndpointPolling::Auto;
+    bool polled = false;       // Auto: true once the bridge reads from the endpoint
+    uint64_t polls = 0;        // process_recv_events() calls
+    uint64_t idle_skips = 0;   // cycles skipped by the idle back-off
+    uint64_t interval_usec = 0; // current gap between polls; 0 = every cycle
+};
+
+/*
+ * Decides which endpoints BridgeCore::cyclic_trigger() pumps with
+ * process_recv_events().
+ *
+ * In Auto mode an endpoint is polled only once a SourceSnapshot reads from
+ * it; endpoints the bridge only writes to, or does not use, are left alone.
+ * With idle back-off enabled, a polled endpoint whose polls have delivered no
+ * receive event for idle_after_usec is polled at a growing interval (starting
+ * at min_interval_usec, doubling up to max_interval_usec). The first poll that
+ * delivers an event puts it back on every cycle. Endpoints that deliver on
+ * their own threads never produce events from a poll, so they settle at the
+ * longest interval unless declared Never.
+ *
+ * In event-loop mode (set by BridgeCore::wait_next_cycle()) idle back-off is
+ * on even without idle_after_usec, using the kEventLoop* defaults: a loop
+ * that sleeps until next_deadline_usec() would otherwise still be woken
+ * every cycle by each endpoint the bridge reads from.
+ *
+ * poll() is meant for the triggering thread; attach_snapshot() and set_mode()
+ * may be called from others. Endpoints are polled outside the internal lock.
+ */
+class EndpointPoller {
+public:
+    void add_endpoint(const std::string& endpoint_id, std::shared_ptr<hakoniwa::pdu::Endpoint> endpoint);
+    // Marks the snapshot's endpoint as read by the bridge.
+    void attach_snapshot(const std::shared_ptr<SourceSnapshot>& snapshot);
+    // False if no endpoint has that id.
+    bool set_mode(const std::string& endpoint_id, EndpointPolling mode);
+    void set_settings(const PollingSettings& settings);
+    void set_event_loop(bool enabled);
+
+    void poll(const CycleContext& ctx);
+    // Earliest now_usec at which poll() has an endpoint to pump; 0 if one is
+    // polled every cycle, kNoDeadline if none is polled.
+    uint64_t next_deadline_usec() const;
+
+    std::vector<EndpointPollStats> stats() const;
+
+private:
+    struct Entry {
+        std::string id;
+        std::shared_ptr<hakoniwa::pdu::Endpoint> endpoint;
+        std::shared_ptr<SourceSnapshot> snapshot; // null until the bridge reads from it
+        EndpointPolling mode = EndpointPolling::Auto;
+        bool started = false;
+        uint64_t last_activity_usec = 0;
+        uint64_t interval_usec = 0;
+        uint64_t next_poll_usec = 0;
+        uint64_t polls = 0;
+        uint64_t idle_skips = 0;
+    };
+
+    static bool polled_(const Entry& entry);
+    Entry* find_(const std::shared_ptr<hakoniwa::pdu::Endpoint>& endpoint);
+    void after_poll_(Entry& entry, uint64_t now_usec, bool active);
+
+    mutable std::mutex mtx_;
+    PollingSettings settings_;
+    bool event_loop_ = false;
+    std::vector<std::unique_ptr<Entry>> entries_; // never erased
+    std::vector<std::pair<Entry*, uint64_t>> due_; // poll() scratch: entry, events before
+};
+
+} // namespace hakoniwa::pdu::bridge
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "hakoniwa/pdu/bridge/pdu_buffer.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge {
+
+/*
+ * Epoch-based reclamation for data published through an atomic pointer.
+ *
+ * A reader pins the domain, loads the pointer (seq_cst) and may use what it
+ * points to until the guard goes away; pinning claims a reader slot with one
+ * CAS and never blocks. A writer swaps the pointer (seq_cst) and then retires
+ * the old object, which is destroyed by a later reclaim() once no reader
+ * pinned before the swap is still inside its guard. Retire and reclaim are
+ * serialised by an internal mutex; readers only ever try_reclaim(), which
+ * gives up instead of waiting for it.
+ */
+class EpochDomain {
+public:
+    // Concurrent guards beyond this wait for a slot to free up.
+    static constexpr size_t kReaderSlots = 64;
+
+    class Guard {
+    public:
+        Guard(Guard&& other) noexcept : slot_(std::exchange(other.slot_, nullptr)) {}
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        Guard& operator=(Guard&&) = delete;
+        ~Guard()
+        {
+            if (slot_) {
+                slot_->store(0, std::memory_order_release);
+            }
+        }
+
+    private:
+        friend class EpochDomain;
+        explicit Guard(std::atomic<uint64_t>* slot) : slot_(slot) {}
+        std::atomic<uint64_t>* slot_;
+    };
+
+    EpochDomain() = default;
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    Guard pin();
+    // Takes ownership of an object already unpublished by the caller.
+    void retire(std::shared_ptr<const void> object);
+    // Destroys the retired objects no pinned reader can still see; returns
+    // how many remain.
+    size_t reclaim();
+    // reclaim() unless another thread is at it; a no-op when nothing is retired.
+    void try_reclaim();
+    size_t pending() const;
+
+private:
+    size_t reclaim_locked_(std::vector<std::shared_ptr<const void>>& doomed);
+
+    struct alignas(kPduBufferAlignment) Slot {
+        std::atomic<uint64_t> epoch{0}; // 0: free
+    };
+
+    std::atomic<uint64_t> global_epoch_{1};
+    std::array<Slot, kReaderSlots> slots_;
+    mutable std::mutex retire_mtx_;
+    std::vector<std::pair<uint64_t, std::shared_ptr<const void>>> retired_;
+    std::atomic<size_t> retired_count_{0};
+};
+
+} // namespace hakoniwa::pdu::bridge
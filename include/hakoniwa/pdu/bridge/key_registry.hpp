@@ -0,0 +1,75 @@
+#pragma once
+
+#include "hakoniwa/pdu/endpoint_types.hpp"
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace hakoniwa::pdu::bridge {
+
+using NameId = uint32_t;
+inline constexpr NameId kInvalidNameId = std::numeric_limits<NameId>::max();
+
+// Interned (robot, pdu_name) pair.
+struct PduKeyId {
+    NameId robot = kInvalidNameId;
+    NameId pdu = kInvalidNameId;
+    bool operator==(const PduKeyId& other) const = default;
+};
+
+/*
+ * Bridge-wide intern table for robot, PDU and connection names.
+ *
+ * Each distinct name gets a dense id the first time it is interned (at build
+ * time, or when a monitor transfer is attached); ids and the strings behind
+ * them are never released. The endpoint API still takes robot names as
+ * strings, so every resolved (robot, channel) key is also stored here once
+ * and shared by all transfers and snapshots using it.
+ *
+ * Interning takes an exclusive lock and lookups a shared one; the returned
+ * references stay valid for the lifetime of the registry.
+ */
+class KeyRegistry {
+public:
+    KeyRegistry() = default;
+    KeyRegistry(const KeyRegistry&) = delete;
+    KeyRegistry& operator=(const KeyRegistry&) = delete;
+
+    NameId intern(std::string_view name);
+    // kInvalidNameId if the name was never interned.
+    NameId find(std::string_view name) const;
+    // Empty string for kInvalidNameId.
+    const std::string& name(NameId id) const;
+
+    PduKeyId intern_pdu(std::string_view robot, std::string_view pdu_name)
+    {
+        return {intern(robot), intern(pdu_name)};
+    }
+    // Members are kInvalidNameId if either name was never interned.
+    PduKeyId find_pdu(std::string_view robot, std::string_view pdu_name) const;
+    // "robot.pdu_name", for diagnostics.
+    std::string label(const PduKeyId& key) const;
+
+    // The shared copy of the resolved (robot, channel_id) key.
+    const hakoniwa::pdu::PduResolvedKey& resolved_key(NameId robot, int channel_id);
+    // Packs an interned robot and a channel into one integer key.
+    static uint64_t code(NameId robot, int channel_id)
+    {
+        return (static_cast<uint64_t>(robot) << 32) | static_cast<uint32_t>(channel_id);
+    }
+
+    size_t size() const;
+
+private:
+    mutable std::shared_mutex mtx_;
+    std::deque<std::string> names_; // indexed by NameId; never moved
+    std::unordered_map<std::string_view, NameId> ids_; // views into names_
+    std::deque<hakoniwa::pdu::PduResolvedKey> resolved_;
+    std::unordered_map<uint64_t, const hakoniwa::pdu::PduResolvedKey*> resolved_index_;
+};
+
+} // namespace hakoniwa::pdu::bridge
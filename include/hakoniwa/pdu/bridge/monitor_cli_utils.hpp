@@ -12,10 +12,33 @@
 
 namespace hakoniwa::pdu::bridge::monitor_cli {
 
+struct CycleBucketView {
+    int64_t lt_usec{-1}; // upper bound; -1 for the open-ended bucket
+    int64_t ge_usec{-1}; // lower bound of the open-ended bucket
+    int64_t count{0};
+};
+
 struct HealthView {
     bool running{false};
     int64_t uptime_usec{0};
     std::string last_error;
+    // Cycle timing; -1 when the bridge does not report it.
+    int64_t period_usec{-1};
+    int64_t cycles{-1};
+    int64_t overruns{-1};
+    int64_t mean_cycle_usec{-1};
+    int64_t max_cycle_usec{-1};
+    int64_t max_jitter_usec{-1};
+    std::vector<CycleBucketView> cycle_histogram; // non-empty buckets only
+};
+
+struct DestinationView {
+    std::string endpoint_id;
+    bool congested{false};
+    int64_t congestion_events{0};
+    int64_t recoveries{0};
+    int64_t coalesced_drops{0};
+    int64_t flushed{0};
 };
 
 struct ConnectionView {
@@ -24,6 +47,22 @@ struct ConnectionView {
     bool active{false};
     int epoch{0};
     bool epoch_validation{false};
+    int64_t batch_frames{-1};
+    int64_t batched_pdus{-1};
+    int64_t budget_bytes_per_sec{-1};
+    int64_t budget_sent_bytes{-1};
+    double budget_utilization{-1.0};
+    int64_t budget_deferred{-1};
+    int64_t budget_dropped{-1};
+    int64_t async_queue_depth{-1};
+    int64_t async_queue_max_depth{-1};
+    int64_t async_sent{-1};
+    int64_t async_dropped{-1};
+    int64_t async_latency_avg_usec{-1};
+    int64_t async_latency_max_usec{-1};
+    int64_t late_joins{-1};
+    int64_t late_join_replays{-1};
+    std::vector<DestinationView> destinations; // backpressure-tracked destinations
 };
 
 struct SessionView {
@@ -38,6 +77,17 @@ struct PduView {
     std::string robot;
     std::string pdu_name;
     int channel_id{-1};
+    int64_t pdu_size{-1};
+    int64_t max_received_size{-1};
+    int64_t transfers{-1};
+    int64_t missed_ticks{-1};
+    int64_t unchanged_skips{-1};
+    int64_t dedupe_suppressed{-1};
+    int64_t trailing_sends{-1};
+    int64_t compressed_in_bytes{-1};
+    int64_t compressed_out_bytes{-1};
+    int64_t compress_usec{-1};
+    int64_t decompress_usec{-1};
 };
 
 bool is_error_response(const nlohmann::json& res);
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "hakoniwa/pdu/bridge/pdu_buffer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace hakoniwa::pdu::bridge {
+
+/*
+ * Optional payload compression for bridge-to-bridge links.
+ *
+ * Payloads below the size threshold, or that do not shrink, go on the wire
+ * unmodified. Compressed payloads are
+ *
+ *   CompressionHeader | compressed bytes
+ *
+ * so the receiving side only needs to know that compression may be in use,
+ * not which algorithm or level the sender picked. As with delta frames, raw
+ * payloads are told apart by the absence of the header magic.
+ *
+ * LZ4 and zstd are only available when the library is built with
+ * HAKO_PDU_BRIDGE_WITH_LZ4 / HAKO_PDU_BRIDGE_WITH_ZSTD.
+ */
+enum class CompressionAlgorithm : uint8_t {
+    None = 0,
+    Lz4 = 1,
+    Zstd = 2,
+};
+
+struct CompressionHeader {
+    static constexpr uint32_t kMagic = 0x315A4348; // "HCZ1"
+    uint32_t magic;
+    uint8_t algorithm;   // CompressionAlgorithm
+    uint8_t reserved[3];
+    uint32_t raw_size;   // decompressed payload size
+};
+static_assert(sizeof(CompressionHeader) == 12, "CompressionHeader is a wire format");
+
+// Payloads smaller than this are sent raw unless a threshold is configured.
+inline constexpr size_t kDefaultCompressionMinBytes = 256;
+
+struct CompressionSettings {
+    CompressionAlgorithm algorithm = CompressionAlgorithm::None;
+    int level = 0; // 0 selects the algorithm default
+    size_t min_bytes = kDefaultCompressionMinBytes;
+};
+
+// "none", "lz4" or "zstd"; std::nullopt for anything else.
+std::optional<CompressionAlgorithm> parse_compression_algorithm(const std::string& name);
+const char* compression_algorithm_name(CompressionAlgorithm algorithm);
+// False if the algorithm was not compiled into this build.
+bool compression_available(CompressionAlgorithm algorithm);
+
+enum class CompressResult {
+    Raw,        // below the threshold or did not shrink; out is data
+    Compressed, // out is a compressed frame in scratch
+    Failed,     // algorithm missing from this build or codec error; out is data
+};
+
+// Sets out to the bytes to send: a compressed frame built in scratch, or data
+// itself if it is not compressed. Data is always sendable as out, whatever
+// the result.
+CompressResult compress_payload(const CompressionSettings& settings, std::span<const std::byte> data,
+                            PduBytes& scratch, std::span<const std::byte>& out);
+
+// Sets out to the decompressed payload (built in scratch), or to wire itself
+// if it is not a compressed frame. Returns false for a corrupt frame, an
+// algorithm missing from this build, or a payload above max_size.
+bool decompress_payload(std::span<const std::byte> wire, size_t max_size,
+                        PduBytes& scratch, std::span<const std::byte>& out);
+
+bool is_compressed_frame(std::span<const std::byte> wire);
+
+} // namespace hakoniwa::pdu::bridge
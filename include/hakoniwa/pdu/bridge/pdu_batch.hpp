@@ -0,0 +1,107 @@
+#pragma once
+
+#include "hakoniwa/pdu/bridge/async_sender.hpp"
+#include "hakoniwa/pdu/bridge/destination_backpressure.hpp"
+#include "hakoniwa/pdu/bridge/payload_compression.hpp"
+#include "hakoniwa/pdu/bridge/pdu_buffer.hpp"
+#include "hakoniwa/pdu/endpoint.hpp"
+#include "hakoniwa/pdu/endpoint_types.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+
+namespace hakoniwa::pdu::bridge {
+
+/*
+ * Multi-PDU container sent on a destination's carrier PDU.
+ *
+ *   BatchHeader
+ *   record_count x { BatchRecordHeader | robot name bytes | payload bytes }
+ *
+ * All integers are host byte order (the bridge already assumes matching
+ * endianness for PDU payloads); records are packed back to back without
+ * padding. channel_id is resolved against the sending bridge's destination
+ * endpoint, so both ends of the link must share the PDU definition, as for
+ * any wire link.
+ */
+struct BatchHeader {
+    static constexpr uint32_t kMagic = 0x31544248; // "HBT1"
+    uint32_t magic;
+    uint32_t record_count;
+};
+static_assert(sizeof(BatchHeader) == 8, "BatchHeader is a wire format");
+
+struct BatchRecordHeader {
+    int32_t channel_id;
+    uint32_t payload_size;
+    uint32_t robot_size;
+};
+static_assert(sizeof(BatchRecordHeader) == 12, "BatchRecordHeader is a wire format");
+
+/*
+ * Collects the payloads a connection sends to one destination during a cycle
+ * and emits them as a single carrier PDU on flush(). The frame is flushed
+ * early whenever the next record would not fit into the carrier PDU.
+ */
+class PduBatch {
+public:
+    PduBatch(std::shared_ptr<hakoniwa::pdu::Endpoint> dst,
+             hakoniwa::pdu::PduResolvedKey carrier_key,
+             size_t carrier_size,
+             CompressionSettings compression = {});
+
+    // Queues payload for key. Returns false if the record can never fit the
+    // carrier; the caller then sends it on its own.
+    bool append(const hakoniwa::pdu::PduResolvedKey& key, std::span<const std::byte> payload);
+    // Sends the queued records as one frame; no-op when nothing is queued.
+    // now_usec is the cycle time reported to the backpressure tracker.
+    void flush(uint64_t now_usec = 0);
+    // Frames are queued on sender instead of being sent inline.
+    void set_async_sender(std::shared_ptr<AsyncSender> sender) { async_sender_ = std::move(sender); }
+    // Frame sends feed the destination's congestion state (from the sender
+    // thread when frames are queued). Records of a frame that fails are not
+    // kept; the transfers coalesce from then on.
+    void set_backpressure(std::shared_ptr<DestinationBackpressure> backpressure)
+    {
+        backpressure_ = std::move(backpressure);
+        async_feedback_ = backpressure_ ? std::make_shared<AsyncSendFeedback>() : nullptr;
+        if (async_feedback_) {
+            async_feedback_->backpressure = backpressure_;
+        }
+    }
+
+    uint64_t frames_sent() const { return frames_sent_.load(std::memory_order_relaxed); }
+    uint64_t records_sent() const { return records_sent_.load(std::memory_order_relaxed); }
+
+private:
+    void flush_locked_();
+
+    std::shared_ptr<hakoniwa::pdu::Endpoint> dst_;
+    std::shared_ptr<AsyncSender> async_sender_;
+    std::shared_ptr<DestinationBackpressure> backpressure_;
+    std::shared_ptr<AsyncSendFeedback> async_feedback_; // carries backpressure_ to the sender
+    hakoniwa::pdu::PduResolvedKey carrier_key_;
+    size_t carrier_size_;
+    CompressionSettings compression_;
+    std::mutex mtx_;
+    PduBytes frame_;
+    PduBytes compress_scratch_;
+    uint32_t record_count_ = 0;
+    uint64_t now_usec_ = 0; // of the last flush(); early flushes reuse it
+    std::atomic<uint64_t> frames_sent_{0};
+    std::atomic<uint64_t> records_sent_{0};
+};
+
+bool is_batch_frame(std::span<const std::byte> frame);
+
+// Validates frame, then calls fn for every record in order. Returns false,
+// without calling fn, if the frame is malformed.
+bool for_each_batch_record(
+    std::span<const std::byte> frame,
+    const std::function<void(const hakoniwa::pdu::PduResolvedKey&, std::span<const std::byte>)>& fn);
+
+} // namespace hakoniwa::pdu::bridge
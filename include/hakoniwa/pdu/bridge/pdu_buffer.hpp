@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge {
+
+// PDU payloads are cache-line aligned so that fixed-layout structs can be read
+// in place and concurrent readers of neighbouring buffers do not share lines.
+inline constexpr std::size_t kPduBufferAlignment = 64;
+
+template <typename T, std::size_t Alignment = kPduBufferAlignment>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+    void deallocate(T* p, std::size_t) noexcept
+    {
+        ::operator delete(p, std::align_val_t{Alignment});
+    }
+
+    // Default-initialise on resize so that growing a payload back to its
+    // declared size before recv() does not zero-fill bytes about to be written.
+    template <typename U>
+    void construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>)
+    {
+        ::new (static_cast<void*>(p)) U;
+    }
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+// The vector size is the number of bytes actually received, which may be less
+// than the declared PDU size for variable-length PDUs; capacity stays reserved.
+using PduBytes = std::vector<std::byte, AlignedAllocator<std::byte>>;
+
+// Immutable PDU payload shared by every transfer that reads the same source PDU
+// within one trigger.
+using PduBufferPtr = std::shared_ptr<const PduBytes>;
+
+} // namespace hakoniwa::pdu::bridge
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace hakoniwa::pdu::bridge {
+
+/*
+ * Fast non-cryptographic 64-bit hash of a PDU payload, used to detect
+ * byte-identical resends. Four independent 64-bit lanes are consumed per
+ * 32-byte block so the multiplies pipeline; the length is mixed in, so
+ * payloads that differ only in size never collide trivially.
+ */
+inline uint64_t hash_pdu_bytes(std::span<const std::byte> data)
+{
+    constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+    constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+
+    auto load = [](const std::byte* p) {
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    };
+    auto round = [](uint64_t acc, uint64_t v) {
+        acc += v * kPrime2;
+        acc = std::rotl(acc, 31);
+        return acc * kPrime1;
+    };
+
+    const std::byte* p = data.data();
+    size_t n = data.size();
+    uint64_t h;
+    if (n >= 32) {
+        uint64_t v1 = kPrime1 + kPrime2;
+        uint64_t v2 = kPrime2;
+        uint64_t v3 = 0;
+        uint64_t v4 = 0 - kPrime1;
+        do {
+            v1 = round(v1, load(p));
+            v2 = round(v2, load(p + 8));
+            v3 = round(v3, load(p + 16));
+            v4 = round(v4, load(p + 24));
+            p += 32;
+            n -= 32;
+        } while (n >= 32);
+        h = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+    }
+    else {
+        h = kPrime3;
+    }
+    h += static_cast<uint64_t>(data.size());
+    while (n >= 8) {
+        h ^= round(0, load(p));
+        h = std::rotl(h, 27) * kPrime1 + kPrime4;
+        p += 8;
+        n -= 8;
+    }
+    if (n > 0) {
+        uint64_t tail = 0;
+        std::memcpy(&tail, p, n);
+        h ^= tail * kPrime1;
+        h = std::rotl(h, 23) * kPrime2 + kPrime3;
+    }
+    // Final avalanche.
+    h ^= h >> 33;
+    h *= kPrime2;
+    h ^= h >> 29;
+    h *= kPrime3;
+    h ^= h >> 32;
+    return h;
+}
+
+} // namespace hakoniwa::pdu::bridge
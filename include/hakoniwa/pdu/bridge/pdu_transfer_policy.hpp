@@ -3,7 +3,7 @@
 #include <chrono>
 #include <memory> // For std::shared_ptr
 #include "hakoniwa/pdu/endpoint_types.hpp"
-#include "hakoniwa/time_source/time_source.hpp" // Include the time source interface
+#include "hakoniwa/pdu/bridge/cycle_clock.hpp" // CycleContext
 
 namespace hakoniwa::pdu::bridge {
 
@@ -13,11 +13,23 @@ public:
 
     virtual bool is_cyclic_trigger() const { return false; }
 
-    // Checks if a transfer should occur using the provided time source.
-    virtual bool should_transfer(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& time_source) = 0;
+    // Checks if a transfer should occur at ctx.now_usec.
+    virtual bool should_transfer(const PduResolvedKey& pdu_key, const CycleContext& ctx) = 0;
 
-    // Notifies the policy that a transfer has occurred, using the provided time source.
-    virtual void on_transferred(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& time_source) = 0;
+    // Notifies the policy that a transfer has occurred at ctx.now_usec.
+    virtual void on_transferred(const PduResolvedKey& pdu_key, const CycleContext& ctx) = 0;
+
+    // Cyclic policies (and a trailing throttle): earliest now_usec at which
+    // should_transfer() can return true. 0 means "evaluate every cycle". The
+    // value may only change as a result of should_transfer()/on_transferred().
+    virtual uint64_t next_deadline_usec() const { return 0; }
+
+    // When true, a due transfer is skipped unless the source delivered a new
+    // receive event since the last one sent.
+    virtual bool requires_new_data() const { return false; }
+
+    // Scheduled transfers the policy dropped instead of sending late.
+    virtual uint64_t missed_ticks() const { return 0; }
 };
 
 } // namespace hakoniwa::pdu::bridge
@@ -1,31 +1,68 @@
 #pragma once
 
+#include "hakoniwa/pdu/bridge/key_registry.hpp"
 #include "hakoniwa/pdu/bridge/pdu_transfer_policy.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory> // For std::shared_ptr
-#include <map>
+#include <unordered_map>
 
 namespace hakoniwa::pdu::bridge {
 
+/*
+ * Immediate transfer, optionally gated by atomic group assembly.
+ *
+ * In atomic mode every group member gets a slot in a readiness bitset. An
+ * arriving member sets its bit with one fetch_or and the member that fills
+ * the last open bit sees the group complete, so callbacks from several
+ * endpoint threads can mark slots concurrently without a lock and the check
+ * costs the same for groups of any size. on_transferred() clears every bit,
+ * so a member arriving again between completion and the reset finds its bit
+ * still set, is not counted, and must arrive once more for the next round.
+ * Only a mark landing between two word exchanges of a group larger than 64
+ * members survives the reset.
+ */
 class ImmediatePolicy : public IPduTransferPolicy {
 public:
-    ImmediatePolicy(bool is_atomic) : is_atomic_(is_atomic) {}
+    static constexpr size_t kInvalidReadySlot = static_cast<size_t>(-1);
+
+    // Atomic mode keeps its slots by interned robot id; pass the registry of
+    // the group's source snapshot to share its names.
+    ImmediatePolicy(bool is_atomic, std::shared_ptr<KeyRegistry> keys = nullptr)
+        : is_atomic_(is_atomic),
+          keys_(keys || !is_atomic ? std::move(keys) : std::make_shared<KeyRegistry>()) {}
     ~ImmediatePolicy() = default;
 
-    void add_pdu_key(const PduResolvedKey& pdu_key) {
-        recv_states_[{pdu_key.robot, pdu_key.channel_id}] = false;        
-    }
+    // Registers a group member and returns its ready slot (the same slot for
+    // a key added twice); kInvalidReadySlot outside atomic mode. Build time
+    // only: must not run concurrently with the methods below.
+    size_t add_pdu_key(const PduResolvedKey& pdu_key);
+
+    // Marks a slot received; true if that completed the group (always true
+    // outside atomic mode). Exactly one caller sees each completion.
+    bool mark_ready(size_t slot);
+    // Clears every slot word by word; marks made before a word is cleared are
+    // dropped with it.
+    void reset_ready();
+    size_t group_size() const { return slot_count_; }
 
-    bool should_transfer(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& time_source) override;
-    void on_transferred(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& time_source) override;
+    bool should_transfer(const PduResolvedKey& pdu_key, const CycleContext& ctx) override;
+    void on_transferred(const PduResolvedKey& pdu_key, const CycleContext& ctx) override;
 
     bool is_cyclic_trigger() const override { return false; }
 private:
     bool is_atomic_ = false;
+    std::shared_ptr<KeyRegistry> keys_; // atomic mode only
 
-    // state for recv for each pdu keys
-    std::map<std::pair<std::string, int>, bool> recv_states_;
+    // slot of each member, by KeyRegistry::code()
+    std::unordered_map<uint64_t, size_t> slot_index_;
+    size_t slot_count_ = 0;
+    size_t word_count_ = 0;
+    std::unique_ptr<std::atomic<uint64_t>[]> ready_words_;
+    // Set bits over all words; only the mark that brings it to slot_count_
+    // completes the group.
+    std::atomic<size_t> ready_count_{0};
 };
 
 } // namespace hakoniwa::pdu::bridge
-
-
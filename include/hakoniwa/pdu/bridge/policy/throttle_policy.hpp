@@ -7,16 +7,28 @@
 
 namespace hakoniwa::pdu::bridge {
 
+/*
+ * Sends an event at once unless the previous one went out less than the
+ * interval ago (leading edge). Events inside the window are dropped, unless
+ * trailing is set: the transfer then keeps a per-PDU dirty flag and sends the
+ * newest value when the window closes, from its cyclic_trigger().
+ */
 class ThrottlePolicy : public IPduTransferPolicy {
 public:
-    explicit ThrottlePolicy(uint64_t interval_microseconds);
+    explicit ThrottlePolicy(uint64_t interval_microseconds, bool trailing = false);
 
-    bool should_transfer(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& time_source) override;
-    void on_transferred(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& time_source) override;
+    bool should_transfer(const PduResolvedKey& pdu_key, const CycleContext& ctx) override;
+    void on_transferred(const PduResolvedKey& pdu_key, const CycleContext& ctx) override;
     bool is_cyclic_trigger() const override { return false; }
+    // End of the current window; 0 before the first transfer.
+    uint64_t next_deadline_usec() const override;
+
+    bool trailing() const { return trailing_; }
+    uint64_t interval_usec() const { return interval_micros_; }
 
 private:
     uint64_t interval_micros_;
+    bool trailing_;
     std::atomic<uint64_t> last_transfer_time_micros_;
     std::atomic<bool> has_transferred_;
 };
@@ -1,24 +1,50 @@
 #pragma once
 
 #include "hakoniwa/pdu/bridge/pdu_transfer_policy.hpp"
+#include <atomic>
 #include <memory> // For std::shared_ptr
 #include <chrono>
 
 namespace hakoniwa::pdu::bridge {
 
+// What a fixed-rate ticker does with ticks it missed while cycles ran late.
+enum class TickerCatchUp {
+    Skip,  // drop every missed tick and resume on the schedule
+    Burst, // fire up to max_burst owed ticks on consecutive cycles, drop the rest
+};
+
+struct TickerSchedule {
+    // false: next tick = transfer time + interval (legacy, drifts under load).
+    // true: next tick = previous tick + interval (anchored, keeps the rate).
+    bool fixed_rate = false;
+    TickerCatchUp catch_up = TickerCatchUp::Skip;
+    uint32_t max_burst = 1;
+    // Skip ticks on which the source has not received anything new.
+    bool only_if_updated = false;
+};
+
 class TickerPolicy : public IPduTransferPolicy {
 public:
-    explicit TickerPolicy(uint64_t interval);
+    // phase_offset delays the first tick (and therefore every later one) so
+    // that tickers sharing an interval do not all fire in the same cycle.
+    explicit TickerPolicy(uint64_t interval, uint64_t phase_offset = 0, TickerSchedule schedule = {});
     ~TickerPolicy() = default;
 
-    bool should_transfer(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& time_source) override;
-    void on_transferred(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& time_source) override;
+    bool should_transfer(const PduResolvedKey& pdu_key, const CycleContext& ctx) override;
+    void on_transferred(const PduResolvedKey& pdu_key, const CycleContext& ctx) override;
     bool is_cyclic_trigger() const override { return true; }
+    // Due immediately until the first check has armed the ticker.
+    uint64_t next_deadline_usec() const override { return initialized_ ? next_tick_time_ : 0; }
+    bool requires_new_data() const override { return schedule_.only_if_updated; }
+    uint64_t missed_ticks() const override { return missed_ticks_.load(std::memory_order_relaxed); }
 
 private:
     uint64_t interval_;
+    uint64_t phase_offset_;
+    TickerSchedule schedule_;
     uint64_t next_tick_time_;
     bool initialized_;
+    std::atomic<uint64_t> missed_ticks_{0};
 };
 
 } // namespace hakoniwa::pdu::bridge
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "hakoniwa/pdu/bridge/cycle_wakeup.hpp"
+#include "hakoniwa/pdu/bridge/key_registry.hpp"
+#include "hakoniwa/pdu/bridge/pdu_buffer.hpp"
+#include "hakoniwa/pdu/endpoint.hpp"
+#include "hakoniwa/pdu/endpoint_types.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge {
+
+/*
+ * Per-source-endpoint read cache.
+ *
+ * A (robot, channel) is read from the endpoint at most once per trigger. A
+ * trigger is either one BridgeCore cycle (begin_cycle()) or one receive event
+ * delivered by the endpoint. The snapshot also owns the endpoint receive
+ * subscription and fans every event out to its listeners, so each source PDU is
+ * subscribed once regardless of how many destinations or monitors use it.
+ *
+ * Keys are resolved to a SlotId at build time (indexed by interned robot id
+ * and channel); the data path only uses slots.
+ * Each slot owns one preallocated buffer which is refilled in place unless a
+ * reader still holds the previous payload. Payloads are trimmed to the bytes
+ * actually received.
+ */
+class SourceSnapshot : public std::enable_shared_from_this<SourceSnapshot> {
+public:
+    using Listener = std::function<void(const hakoniwa::pdu::PduResolvedKey&, std::span<const std::byte>)>;
+    using ListenerId = uint64_t;
+    using SlotId = uint32_t;
+    static constexpr SlotId kInvalidSlot = std::numeric_limits<SlotId>::max();
+
+    // Without a registry the snapshot interns into one of its own. wakeup,
+    // if given, is notified after every receive event.
+    explicit SourceSnapshot(
+        std::shared_ptr<hakoniwa::pdu::Endpoint> endpoint,
+        std::shared_ptr<KeyRegistry> keys = nullptr,
+        std::shared_ptr<CycleWakeup> wakeup = nullptr)
+        : endpoint_(std::move(endpoint)),
+          keys_(keys ? std::move(keys) : std::make_shared<KeyRegistry>()),
+          wakeup_(std::move(wakeup)) {}
+
+    const std::shared_ptr<hakoniwa::pdu::Endpoint>& endpoint() const { return endpoint_; }
+    const std::shared_ptr<KeyRegistry>& keys() const { return keys_; }
+
+    // Registers a key and subscribes to its receive events. Idempotent: the
+    // same key always maps to the same slot.
+    SlotId register_key(const hakoniwa::pdu::PduResolvedKey& key, size_t pdu_size);
+    // Build-time/introspection lookup; returns kInvalidSlot if not registered.
+    SlotId find_slot(const hakoniwa::pdu::PduResolvedKey& key) const;
+
+    // Listeners are invoked for every receive event of the slot. Removal waits
+    // for an in-flight notification of that slot to finish.
+    ListenerId add_listener(SlotId slot, Listener listener);
+    void remove_listener(ListenerId id);
+
+    // Invalidates every cached entry. Called once at the start of each cycle.
+    void begin_cycle() { cycle_.fetch_add(1, std::memory_order_acq_rel); }
+
+    // Returns the payload of the slot for the current trigger, reading it from
+    // the endpoint only if it has not been read yet. Failures are cached too,
+    // so queue-backed sources are never drained twice in one trigger.
+    // out_buffer->size() == out_received_size, which may be below the declared
+    // PDU size for variable-length PDUs.
+    HakoPduErrorType read(SlotId slot, PduBufferPtr& out_buffer, size_t& out_received_size);
+
+    // Number of receive events seen for the slot; changes whenever the source
+    // delivers new data. 0 until the first event.
+    uint64_t sequence(SlotId slot) const;
+
+    // Largest payload received for the slot so far (0 if none yet).
+    size_t high_water_mark(SlotId slot) const;
+
+    uint64_t endpoint_read_count() const { return endpoint_reads_.load(std::memory_order_relaxed); }
+    // Receive events delivered by the endpoint, over all slots.
+    uint64_t event_count() const { return events_.load(std::memory_order_acquire); }
+    // True once a key is registered, i.e. the endpoint has a bridge subscription.
+    bool has_keys() const { return key_count_.load(std::memory_order_acquire) != 0; }
+
+private:
+    struct Entry {
+        const hakoniwa::pdu::PduResolvedKey* key = nullptr; // owned by keys_
+        size_t pdu_size = 0;
+
+        std::mutex data_mtx;
+        bool cached = false;
+        uint64_t cached_cycle = 0;
+        uint64_t cached_sequence = 0;
+        uint64_t sequence = 0; // bumped on every receive event
+        HakoPduErrorType cached_error = HAKO_PDU_ERR_OK;
+        std::shared_ptr<PduBytes> buffer;
+        size_t received_size = 0;
+        size_t high_water_mark = 0;
+
+        std::mutex listener_mtx;
+        std::vector<std::pair<ListenerId, Listener>> listeners;
+    };
+
+    Entry* slot_(SlotId slot) const;
+    void on_recv_(Entry& entry, const hakoniwa::pdu::PduResolvedKey& key, std::span<const std::byte> data);
+
+    std::shared_ptr<hakoniwa::pdu::Endpoint> endpoint_;
+    std::shared_ptr<KeyRegistry> keys_;
+    std::shared_ptr<CycleWakeup> wakeup_;
+    mutable std::mutex entries_mtx_;
+    std::unordered_map<uint64_t, SlotId> slot_index_; // KeyRegistry::code()
+    std::vector<std::unique_ptr<Entry>> entries_;
+    std::atomic<uint64_t> cycle_{1};
+    std::atomic<uint64_t> endpoint_reads_{0};
+    std::atomic<uint64_t> events_{0};
+    std::atomic<size_t> key_count_{0};
+    ListenerId next_listener_id_{1};
+};
+
+} // namespace hakoniwa::pdu::bridge
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+namespace hakoniwa::pdu::bridge {
+
+// Per-PDU transfer statistics, summed over every destination of a connection.
+struct TransferCounters {
+    uint64_t transfers = 0;    // payloads written to a destination
+    uint64_t missed_ticks = 0; // fixed-rate ticks dropped by the catch-up rule
+    uint64_t unchanged_skips = 0; // due transfers skipped because nothing new arrived
+    uint64_t dedupe_suppressed = 0; // sends dropped as byte-identical to the previous one
+    uint64_t trailing_sends = 0; // held-back throttle events sent when their window closed
+    uint64_t compressed_in_bytes = 0;  // payload bytes through the compression stage
+    uint64_t compressed_out_bytes = 0; // bytes it sent, raw fallbacks included
+    uint64_t compress_errors = 0; // codec failures, each sent raw instead
+    uint64_t compress_ns = 0;
+    uint64_t decompress_ns = 0;
+};
+
+} // namespace hakoniwa::pdu::bridge
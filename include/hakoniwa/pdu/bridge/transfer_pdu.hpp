@@ -2,7 +2,19 @@
 
 #include "hakoniwa/pdu/bridge/bridge_types.hpp" // For hakoniwa::pdu::bridge::PduKey
 #include "hakoniwa/pdu/bridge/pdu_transfer_policy.hpp"
-#include "hakoniwa/time_source/time_source.hpp" // Include for ITimeSource
+#include "hakoniwa/pdu/bridge/source_snapshot.hpp"
+#include "hakoniwa/pdu/bridge/bandwidth_budget.hpp"
+#include "hakoniwa/pdu/bridge/async_sender.hpp"
+#include "hakoniwa/pdu/bridge/destination_backpressure.hpp"
+#include "hakoniwa/pdu/bridge/cycle_clock.hpp"
+#include "hakoniwa/pdu/bridge/delta_codec.hpp"
+#include "hakoniwa/pdu/bridge/destination_presence.hpp"
+#include "hakoniwa/pdu/bridge/key_registry.hpp"
+#include "hakoniwa/pdu/bridge/payload_compression.hpp"
+#include "hakoniwa/pdu/bridge/pdu_batch.hpp"
+#include "hakoniwa/pdu/bridge/policy/immediate_policy.hpp"
+#include "hakoniwa/pdu/bridge/policy/throttle_policy.hpp"
+#include "hakoniwa/pdu/bridge/transfer_counters.hpp"
 #include "hakoniwa/pdu/endpoint.hpp" // Actual Endpoint class
 #include "hakoniwa/pdu/endpoint_types.hpp" // For hakoniwa::pdu::PduKey
 #include "hakoniwa/pdu/pdu_definition.hpp" // For hakoniwa::pdu::PduDefinition
@@ -12,6 +24,7 @@
 #include <chrono>
 #include <vector> // For temporary buffer in transfer()
 #include <atomic>
+#include <mutex>
 
 namespace hakoniwa::pdu::bridge {
 
@@ -19,10 +32,29 @@ class ITransferPdu {
 public:
     virtual ~ITransferPdu() = default;
 
-    virtual void cyclic_trigger() = 0;
+    virtual void cyclic_trigger(const CycleContext& ctx) = 0;
+    // Earliest CycleContext::now_usec at which cyclic_trigger() has work to do;
+    // 0 means every cycle, kNoDeadline means never. Re-read after every
+    // cyclic_trigger() by the connection scheduler.
+    virtual uint64_t next_deadline_usec() const { return 0; }
+    // Flag to raise when the deadline moves between two cyclic_trigger()
+    // calls, e.g. from an event callback; the connection then re-reads the
+    // deadlines on its next cycle. Set by the connection on registration.
+    virtual void set_deadline_notifier(std::atomic<bool>* /* changed */) {}
     virtual void set_active(bool is_active) = 0;
     virtual void set_epoch(uint8_t epoch) = 0;
     virtual void set_epoch_validation(bool enable) = 0;
+    // Due transfers of one cycle run in priority order, then registration order.
+    virtual TransferPriority priority() const { return TransferPriority::Normal; }
+    // Sends the value held back while the destination was congested, if any.
+    // Called by the connection once the destination has recovered.
+    virtual void flush_coalesced(const CycleContext& /* ctx */) {}
+    // Resends the latest value to a destination that has just joined, if the
+    // transfer keeps one. Called by the connection on every join.
+    virtual void replay_latest(const CycleContext& /* ctx */) {}
+    // Adds this transfer's counters to out if it forwards key (interned in
+    // the registry of its source snapshot).
+    virtual void accumulate_counters(const PduKeyId& /* key */, TransferCounters& /* out */) const {}
 };
 
 class TransferPdu : public ITransferPdu {
@@ -30,42 +62,204 @@ public:
     TransferPdu(
         const hakoniwa::pdu::bridge::PduKey& config_key, // The PduKey from bridge.json
         std::shared_ptr<IPduTransferPolicy> policy,
-        std::shared_ptr<hakoniwa::time_source::ITimeSource> time_source,
-        std::shared_ptr<hakoniwa::pdu::Endpoint> src,
+        std::shared_ptr<CycleClock> clock,
+        std::shared_ptr<SourceSnapshot> src,
         std::shared_ptr<hakoniwa::pdu::Endpoint> dst
     );
+    ~TransferPdu() override;
 
     void set_active(bool is_active) override;
     void set_epoch(uint8_t epoch) override;
     void set_epoch_validation(bool enable) override { epoch_validation_ = enable; }
+    void set_deadline_notifier(std::atomic<bool>* changed) override { deadline_changed_ = changed; }
+    // Suppresses sends whose payload is byte-identical to the last one sent.
+    // refresh_usec > 0 forces a resend once that long has passed since the
+    // last send; 0 suppresses duplicates indefinitely. Call before the
+    // transfer is added to a connection.
+    void enable_dedupe(uint64_t refresh_usec);
+    // Sends keyframe/delta frames instead of full payloads (see delta_codec.hpp);
+    // the receiving bridge must use enable_delta_decode() on the same PDU.
+    void enable_delta_encode(uint32_t keyframe_interval);
+    // Rebuilds full payloads from keyframe/delta frames before forwarding.
+    void enable_delta_decode();
+    // Compresses payloads on their way to the destination (see
+    // payload_compression.hpp), and/or decompresses payloads from a source
+    // fed by a compressing peer. Call before the transfer is added.
+    void enable_compression(const CompressionSettings& settings);
+    void enable_decompression();
+    // Cyclic sends are queued on batch (flushed by the connection once per
+    // cycle) instead of being sent one by one; event-driven sends are not.
+    void set_batch(std::shared_ptr<PduBatch> batch) { batch_ = std::move(batch); }
+    // Splits batch frames from the source into their PDUs and writes each to
+    // the destination; other payloads are forwarded as usual.
+    void enable_unbatch() { unbatch_ = true; }
+    // Charges every send against budget (shared by the connection's transfers
+    // to the same destination); see bandwidth_budget.hpp for how each
+    // priority is treated once it is exhausted.
+    void set_budget(std::shared_ptr<BandwidthBudget> budget) { budget_ = std::move(budget); }
+    void set_priority(TransferPriority priority) { priority_ = priority; }
+    TransferPriority priority() const override { return priority_; }
+    // Hands payloads to the destination's sender thread instead of calling
+    // send() on the triggering thread. A payload the sender drops on
+    // overflow counts as not sent; one it loses after queueing (evicted, or
+    // send() failed) is no longer taken as held by the destination for dedupe.
+    void set_async_sender(std::shared_ptr<AsyncSender> sender)
+    {
+        async_sender_ = std::move(sender);
+        async_feedback_ = async_sender_ ? std::make_shared<AsyncSendFeedback>() : nullptr;
+        if (async_feedback_) {
+            async_feedback_->backpressure = backpressure_;
+        }
+    }
+    // Tracks send failures and slow sends on backpressure (shared by the
+    // connection's transfers to the same destination). While it reports the
+    // destination congested only the newest value is kept, and it is sent by
+    // flush_coalesced(). Cyclic transfers do not even read the source then.
+    // With an async sender the sender thread reports the sends.
+    void set_backpressure(std::shared_ptr<DestinationBackpressure> backpressure)
+    {
+        backpressure_ = std::move(backpressure);
+        if (async_feedback_) {
+            async_feedback_->backpressure = backpressure_;
+        }
+    }
+    void flush_coalesced(const CycleContext& ctx) override;
+    // Keeps a copy of the last payload forwarded and resends it once for
+    // every join presence reports (see destination_presence.hpp), bypassing
+    // dedupe and starting a fresh delta keyframe chain.
+    void set_presence(std::shared_ptr<DestinationPresence> presence) { presence_ = std::move(presence); }
+    void replay_latest(const CycleContext& ctx) override;
     
-    // Attempts to transfer data based on the policy.
-    void cyclic_trigger() override
+    // Attempts to transfer data based on the policy. A send deferred by the
+    // budget is retried every cycle, with the latest data, until it goes out
+    // or the next tick takes over. A trailing throttle sends the event it
+    // held back once its window has closed.
+    void cyclic_trigger(const CycleContext& ctx) override
+    {
+        if (trailing_) {
+            flush_trailing_(ctx);
+            return;
+        }
+        if (!policy_->is_cyclic_trigger()) {
+            return;
+        }
+        if (deferred_ && is_active_ && ctx.now_usec < policy_->next_deadline_usec()) {
+            transfer(ctx);
+        }
+        else {
+            try_transfer(ctx);
+        }
+    }
+    uint64_t next_deadline_usec() const override
     {
-        if (policy_->is_cyclic_trigger()) {
-            try_transfer();
+        if (trailing_) {
+            return deferred_ ? 0 : trailing_check_usec_.load();
+        }
+        if (!policy_->is_cyclic_trigger()) {
+            return kNoDeadline;
         }
+        return deferred_ ? 0 : policy_->next_deadline_usec();
     }
+    void accumulate_counters(const PduKeyId& key, TransferCounters& out) const override;
         
 private:
-    hakoniwa::pdu::bridge::PduKey           config_pdu_key_; // PDU key from bridge.json
-    hakoniwa::pdu::PduKey               endpoint_pdu_key_; // PDU key for endpoint API
-    hakoniwa::pdu::PduResolvedKey     endpoint_pdu_resolved_key_; // Resolved PDU key for endpoint API
+    // Names are interned in the snapshot's KeyRegistry, which also owns the
+    // resolved keys handed to the endpoint API.
+    PduKeyId                          key_id_;
+    const hakoniwa::pdu::PduResolvedKey* src_key_; // resolved against the source endpoint
+    const hakoniwa::pdu::PduResolvedKey* dst_key_; // resolved against the destination endpoint
+    SourceSnapshot::SlotId            src_slot_ = SourceSnapshot::kInvalidSlot;
     std::shared_ptr<IPduTransferPolicy> policy_;
+    std::shared_ptr<CycleClock>                         clock_;
+    std::shared_ptr<SourceSnapshot>                     src_snapshot_;
     std::shared_ptr<hakoniwa::pdu::Endpoint>            src_endpoint_;
     std::shared_ptr<hakoniwa::pdu::Endpoint>            dst_endpoint_;
-    std::shared_ptr<hakoniwa::time_source::ITimeSource>  time_source_;
-    bool is_active_ = false;
+    SourceSnapshot::ListenerId listener_id_ = 0;
+    size_t pdu_size_ = 0;
+    std::atomic<bool> is_active_{false};
     std::atomic<uint8_t> owner_epoch_{0};
     bool epoch_validation_ = false;
+    std::atomic<uint64_t> transfers_{0};
+    std::atomic<uint64_t> unchanged_skips_{0};
+    uint64_t last_sent_sequence_ = 0; // cyclic path only
+    // Content dedupe; state is guarded because event callbacks may overlap.
+    bool dedupe_enabled_ = false;
+    uint64_t dedupe_refresh_usec_ = 0;
+    std::mutex dedupe_mtx_;
+    bool dedupe_has_last_ = false;
+    uint64_t dedupe_last_hash_ = 0;
+    uint64_t dedupe_last_send_usec_ = 0;
+    uint64_t dedupe_seen_lost_ = 0; // async_feedback_->lost at the last check
+    std::atomic<uint64_t> dedupe_suppressed_{0};
+    // Delta codec (at most one of the two is set) and compression stage.
+    // Guarded like the dedupe state; the scratch buffers back the sent spans.
+    std::mutex codec_mtx_;
+    std::unique_ptr<DeltaEncoder> delta_encoder_;
+    std::unique_ptr<DeltaDecoder> delta_decoder_;
+    CompressionSettings compression_;
+    bool decompress_ = false;
+    PduBytes compress_scratch_;
+    PduBytes decompress_scratch_;
+    std::atomic<uint64_t> compressed_in_bytes_{0};
+    std::atomic<uint64_t> compressed_out_bytes_{0};
+    std::atomic<uint64_t> compress_errors_{0};
+    std::atomic<uint64_t> compress_ns_{0};
+    std::atomic<uint64_t> decompress_ns_{0};
+    std::shared_ptr<PduBatch> batch_;
+    bool unbatch_ = false;
+    // Size the destination declares for each batched record key, looked up
+    // once per key; 0 when the key is not defined there.
+    std::mutex record_sizes_mtx_;
+    std::vector<std::pair<hakoniwa::pdu::PduResolvedKey, size_t>> record_sizes_;
+    std::shared_ptr<BandwidthBudget> budget_;
+    TransferPriority priority_ = TransferPriority::Normal;
+    bool deferred_ = false; // cyclic path only
+    std::shared_ptr<AsyncSender> async_sender_;
+    std::shared_ptr<AsyncSendFeedback> async_feedback_;
+    std::shared_ptr<DestinationBackpressure> backpressure_;
+    bool cyclic_coalesced_ = false; // cyclic path: re-read the source on flush
+    std::mutex coalesce_mtx_;       // event path: newest payload held back
+    PduBytes coalesced_;
+    bool has_coalesced_ = false;
+    // Trailing throttle: set by an event inside the window; the newest value
+    // is read back from the snapshot when the window closes. The event that
+    // sets it pulls the check in to the window end and notifies the connection.
+    std::shared_ptr<ThrottlePolicy> trailing_;
+    std::atomic<bool> trailing_pending_{false};
+    std::atomic<uint64_t> trailing_check_usec_{0};
+    std::atomic<uint64_t> trailing_sends_{0};
+    std::atomic<bool>* deadline_changed_ = nullptr;
+    // Late-joiner replay: the last payload forwarded, as received.
+    std::shared_ptr<DestinationPresence> presence_;
+    uint64_t replayed_joins_ = 0; // cyclic path only
+    std::mutex latest_mtx_;
+    PduBytes latest_;
+    bool has_latest_ = false;
     void on_recv_callback(const hakoniwa::pdu::PduResolvedKey& pdu_key, std::span<const std::byte> data)
     {
         //std::cout << "TransferPdu: on_recv_callback triggered for Robot: " << pdu_key.robot << " Channel ID: " << pdu_key.channel_id << std::endl;
-        try_transfer();
+        try_transfer(clock_->event_context(), data);
     }
-    void try_transfer();
+    // event_data is the payload delivered by the receive callback; when present
+    // it is forwarded as-is instead of being read back from the source.
+    void try_transfer(const CycleContext& ctx, std::span<const std::byte> event_data = {});
 
-    void transfer();
+    // Returns true if the payload was sent (see forward()).
+    bool transfer(const CycleContext& ctx);
+    // Returns true if the destination holds the payload afterwards (written
+    // now, queued on the batch, or suppressed as a duplicate of the last
+    // write). Only the cyclic path is batched or deferred by the budget.
+    bool forward(const CycleContext& ctx, std::span<const std::byte> data, bool cyclic = false);
+    bool epoch_matches_(std::span<const std::byte> data) const;
+    // "robot.pdu_name", for diagnostics.
+    std::string label_() const;
+    bool forward_batch_(std::span<const std::byte> frame);
+    size_t record_size_(const hakoniwa::pdu::PduResolvedKey& key);
+    // Holds data back as the newest value for flush_coalesced().
+    void coalesce_(std::span<const std::byte> data, bool cyclic);
+    void flush_trailing_(const CycleContext& ctx);
+    // Records data as the value to replay to a late joiner.
+    void remember_latest_(std::span<const std::byte> data);
 };
 
 
@@ -74,31 +268,73 @@ public:
     TransferAtomicPduGroup(
         const std::vector<hakoniwa::pdu::bridge::PduKey>& config_keys,
         std::shared_ptr<IPduTransferPolicy> policy,
-        std::shared_ptr<hakoniwa::time_source::ITimeSource> time_source,
-        std::shared_ptr<hakoniwa::pdu::Endpoint> src,
+        std::shared_ptr<CycleClock> clock,
+        std::shared_ptr<SourceSnapshot> src,
         std::shared_ptr<hakoniwa::pdu::Endpoint> dst
     );
+    ~TransferAtomicPduGroup() override;
     void set_active(bool is_active) override;
     void set_epoch(uint8_t epoch) override;
     void set_epoch_validation(bool enable) override { epoch_validation_ = enable; }
     // Event-driven only; cyclic_trigger is intentionally ignored.
-    void cyclic_trigger() override;
+    void cyclic_trigger(const CycleContext& ctx) override;
+    uint64_t next_deadline_usec() const override { return kNoDeadline; }
+    void accumulate_counters(const PduKeyId& key, TransferCounters& out) const override;
+    // Same stages as TransferPdu, applied per member.
+    void enable_compression(const CompressionSettings& settings) { compression_ = settings; }
+    void enable_decompression() { decompress_ = true; }
+    // A group is charged as a whole and never deferred: once the budget is
+    // exhausted only High groups go out.
+    void set_budget(std::shared_ptr<BandwidthBudget> budget) { budget_ = std::move(budget); }
+    void set_priority(TransferPriority priority) { priority_ = priority; }
+    TransferPriority priority() const override { return priority_; }
 private:
-    std::vector<std::unique_ptr<hakoniwa::pdu::PduResolvedKey>> transfer_atomic_pdu_group_;
+    // Resolved once at construction; try_transfer_group() only touches these.
+    struct Member {
+        PduKeyId key_id;
+        const hakoniwa::pdu::PduResolvedKey* src_key; // owned by the snapshot's KeyRegistry
+        const hakoniwa::pdu::PduResolvedKey* dst_key;
+        size_t pdu_size = 0;
+        SourceSnapshot::SlotId slot = SourceSnapshot::kInvalidSlot;
+        size_t ready_slot = ImmediatePolicy::kInvalidReadySlot; // atomic policy only
+        PduBufferPtr staged; // held only while a group transfer is in progress
+        std::span<const std::byte> payload;
+        PduBytes compress_scratch;   // back payload/wire spans when the
+        PduBytes decompress_scratch; // compression stages are enabled
+    };
+    std::vector<Member> members_;
     std::shared_ptr<IPduTransferPolicy> policy_;
-    std::shared_ptr<hakoniwa::time_source::ITimeSource> time_source_;
+    // Set when policy_ is an ImmediatePolicy; members then mark their ready
+    // slot directly instead of being looked up by key.
+    std::shared_ptr<ImmediatePolicy> immediate_policy_;
+    std::shared_ptr<CycleClock>                         clock_;
+    std::shared_ptr<SourceSnapshot>                     src_snapshot_;
     std::shared_ptr<hakoniwa::pdu::Endpoint>            src_endpoint_;
     std::shared_ptr<hakoniwa::pdu::Endpoint>            dst_endpoint_;
-    bool is_active_ = false;
+    std::vector<SourceSnapshot::ListenerId> listener_ids_;
+    std::atomic<bool> is_active_{false};
     std::atomic<uint8_t> owner_epoch_{0};
     bool epoch_validation_ = false;
-    void on_recv_callback(const hakoniwa::pdu::PduResolvedKey& pdu_key, std::span<const std::byte> data)
+    std::atomic<uint64_t> frames_sent_{0};
+    CompressionSettings compression_;
+    bool decompress_ = false;
+    std::atomic<uint64_t> compressed_in_bytes_{0};
+    std::atomic<uint64_t> compressed_out_bytes_{0};
+    std::atomic<uint64_t> compress_errors_{0};
+    std::atomic<uint64_t> compress_ns_{0};
+    std::atomic<uint64_t> decompress_ns_{0};
+    std::shared_ptr<BandwidthBudget> budget_;
+    TransferPriority priority_ = TransferPriority::Normal;
+    void on_recv_callback(size_t member_index, const hakoniwa::pdu::PduResolvedKey& pdu_key, std::span<const std::byte> data)
     {
         //std::cout << "TransferAtomicPduGroup: on_recv_callback triggered for Robot: " << pdu_key.robot << " Channel ID: " << pdu_key.channel_id << std::endl;
-        try_transfer(pdu_key, data);
+        try_transfer(member_index, pdu_key, data);
     }
-    void try_transfer(const hakoniwa::pdu::PduResolvedKey& pdu_key, std::span<const std::byte> data);
-    void try_transfer_group();
+    void try_transfer(size_t member_index, const hakoniwa::pdu::PduResolvedKey& pdu_key, std::span<const std::byte> data);
+    std::string label_(const Member& member) const;
+    // The triggering member is sent straight from the callback span; the other
+    // members are read from the source snapshot.
+    void try_transfer_group(const CycleContext& ctx, size_t trigger_index, std::span<const std::byte> trigger_data);
 };
 
 } // namespace hakoniwa::pdu::bridge
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "hakoniwa/pdu/bridge/bandwidth_budget.hpp"
+#include "hakoniwa/pdu/bridge/cycle_clock.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge {
+
+class ITransferPdu;
+
+struct ScheduledTransfer {
+    ITransferPdu* transfer;
+    uint64_t seq; // registration order; also the identity used by sync()
+};
+
+/*
+ * Deadline-ordered min-heap of cyclic transfers.
+ *
+ * run_due() only visits transfers whose next_deadline_usec() has been reached,
+ * so a cycle costs O(due * log n) instead of O(n). Transfers reporting
+ * kNoDeadline (event-driven policies) are never queued. Due transfers run in
+ * priority order, so High sends reach a shared bandwidth budget first; within
+ * a priority the most overdue goes first (a send deferred by the budget
+ * reports deadline 0), then registration order, as a plain scan would.
+ *
+ * Membership follows the connection's published transfer list through
+ * sync(). Transfers are identified by seq, never by address, so a removed
+ * transfer is not dereferenced again and a new one reusing its memory is not
+ * mistaken for it.
+ *
+ * Not thread-safe; the owning BridgeConnection serialises access.
+ */
+class TransferScheduler {
+public:
+    // Makes the queue match transfers (ascending seq): new ones are queued,
+    // missing ones dropped.
+    void sync(const std::vector<ScheduledTransfer>& transfers);
+
+    void run_due(const CycleContext& ctx);
+    // Re-reads the deadline of every queued transfer, for deadlines that
+    // moved outside run_due() (see ITransferPdu::set_deadline_notifier()).
+    void resync();
+
+    // Earliest queued deadline, or kNoDeadline if nothing is queued.
+    uint64_t next_deadline_usec() const { return heap_.empty() ? kNoDeadline : heap_.front().deadline_usec; }
+    size_t size() const { return heap_.size(); }
+
+private:
+    struct Entry {
+        uint64_t deadline_usec;
+        uint64_t seq; // registration order
+        TransferPriority priority;
+        ITransferPdu* transfer;
+    };
+    // std::push_heap builds a max-heap; invert to keep the earliest on top.
+    struct Later {
+        bool operator()(const Entry& a, const Entry& b) const
+        {
+            return a.deadline_usec != b.deadline_usec ? a.deadline_usec > b.deadline_usec : a.seq > b.seq;
+        }
+    };
+
+    void push_(ITransferPdu* transfer, uint64_t seq);
+
+    std::vector<Entry> heap_;
+    std::vector<Entry> due_; // scratch, reused every cycle
+    std::vector<uint64_t> members_; // seqs of the synced transfers, ascending
+    std::vector<uint64_t> removed_; // scratch for sync()
+};
+
+} // namespace hakoniwa::pdu::bridge
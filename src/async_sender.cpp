@@ -0,0 +1,213 @@
+#include "hakoniwa/pdu/bridge/async_sender.hpp"
+#include <chrono>
+#include <iostream>
+
+namespace hakoniwa::pdu::bridge {
+
+namespace {
+uint64_t steady_now_ns()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void store_max(std::atomic<uint64_t>& target, uint64_t value)
+{
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void report_lost(std::shared_ptr<AsyncSendFeedback>& feedback, uint64_t now_usec, uint64_t send_usec = 0)
+{
+    if (feedback) {
+        feedback->lost.fetch_add(1, std::memory_order_release);
+        if (feedback->backpressure) {
+            feedback->backpressure->on_send(now_usec, false, send_usec);
+        }
+        feedback.reset();
+    }
+}
+} // namespace
+
+std::optional<AsyncOverflowPolicy> parse_async_overflow_policy(const std::string& name)
+{
+    if (name == "dropOldest") {
+        return AsyncOverflowPolicy::DropOldest;
+    }
+    if (name == "dropNewest") {
+        return AsyncOverflowPolicy::DropNewest;
+    }
+    if (name == "block") {
+        return AsyncOverflowPolicy::Block;
+    }
+    return std::nullopt;
+}
+
+AsyncSender::AsyncSender(std::shared_ptr<hakoniwa::pdu::Endpoint> dst, const AsyncSendSettings& settings)
+    : dst_(std::move(dst)), settings_(settings), ring_(settings.depth)
+{
+    thread_ = std::thread([this]() { run_(); });
+}
+
+AsyncSender::~AsyncSender()
+{
+    stopping_.store(true, std::memory_order_seq_cst);
+    wake_seq_.fetch_add(1, std::memory_order_seq_cst);
+    wake_seq_.notify_one();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+HakoPduErrorType AsyncSender::enqueue(const hakoniwa::pdu::PduResolvedKey& key, std::span<const std::byte> payload,
+                                      const std::shared_ptr<AsyncSendFeedback>& feedback, uint64_t now_usec)
+{
+    const uint64_t now_ns = steady_now_ns();
+    // Taken before an eviction below can congest the destination itself.
+    const bool probe = feedback && feedback->backpressure && feedback->backpressure->congested();
+    while (!push_(key, payload, now_ns, feedback, now_usec, probe)) {
+        if (stopping_.load(std::memory_order_relaxed)) {
+            return HAKO_PDU_ERR_BUSY;
+        }
+        switch (settings_.overflow) {
+        case AsyncOverflowPolicy::DropNewest:
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return HAKO_PDU_ERR_BUSY;
+        case AsyncOverflowPolicy::DropOldest:
+            // Another producer may take the freed slot first; then drop again.
+            if (ring_.try_pop([](Item& item) { report_lost(item.feedback, item.now_usec); })) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+            break;
+        case AsyncOverflowPolicy::Block:
+            std::this_thread::yield();
+            break;
+        }
+    }
+    enqueued_.fetch_add(1, std::memory_order_relaxed);
+    store_max(max_depth_, ring_.size());
+    wake_sender_();
+    return HAKO_PDU_ERR_OK;
+}
+
+bool AsyncSender::push_(const hakoniwa::pdu::PduResolvedKey& key, std::span<const std::byte> payload, uint64_t now_ns,
+                        const std::shared_ptr<AsyncSendFeedback>& feedback, uint64_t now_usec, bool probe)
+{
+    // Assigning in place reuses the slot's capacity.
+    return ring_.try_push([&](Item& item) {
+        item.key.robot.assign(key.robot);
+        item.key.channel_id = key.channel_id;
+        item.payload.assign(payload.begin(), payload.end());
+        item.enqueue_ns = now_ns;
+        item.feedback = feedback;
+        item.now_usec = now_usec;
+        item.probe = probe;
+    });
+}
+
+void AsyncSender::pause()
+{
+    paused_.store(true, std::memory_order_seq_cst);
+    wake_seq_.fetch_add(1, std::memory_order_seq_cst);
+    wake_seq_.notify_one();
+    while (!parked_.load(std::memory_order_acquire) && !stopping_.load(std::memory_order_relaxed)) {
+        std::this_thread::yield();
+    }
+}
+
+void AsyncSender::resume()
+{
+    paused_.store(false, std::memory_order_seq_cst);
+    wake_seq_.fetch_add(1, std::memory_order_seq_cst);
+    wake_seq_.notify_one();
+}
+
+void AsyncSender::wake_sender_()
+{
+    // Pairs with the fence in run_(): either the sender sees the new item on
+    // its re-check, or this thread sees it waiting and bumps wake_seq_.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sender_waiting_.load(std::memory_order_relaxed)) {
+        wake_seq_.fetch_add(1, std::memory_order_relaxed);
+        wake_seq_.notify_one();
+    }
+}
+
+void AsyncSender::run_()
+{
+    Item current;
+    auto take = [&current](Item& item) {
+        // Swap rather than copy: the slot keeps the previous buffer for reuse.
+        current.key.robot.swap(item.key.robot);
+        current.key.channel_id = item.key.channel_id;
+        current.payload.swap(item.payload);
+        current.enqueue_ns = item.enqueue_ns;
+        current.feedback.swap(item.feedback);
+        current.now_usec = item.now_usec;
+        current.probe = item.probe;
+    };
+    while (!stopping_.load(std::memory_order_relaxed)) {
+        if (paused_.load(std::memory_order_acquire)) {
+            const uint32_t seen = wake_seq_.load(std::memory_order_acquire);
+            parked_.store(true, std::memory_order_release);
+            if (paused_.load(std::memory_order_acquire) && !stopping_.load(std::memory_order_relaxed)) {
+                wake_seq_.wait(seen, std::memory_order_acquire);
+            }
+            parked_.store(false, std::memory_order_relaxed);
+            continue;
+        }
+        if (!ring_.try_pop(take)) {
+            const uint32_t seen = wake_seq_.load(std::memory_order_acquire);
+            sender_waiting_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const bool popped = ring_.try_pop(take);
+            if (!popped && !stopping_.load(std::memory_order_relaxed)) {
+                wake_seq_.wait(seen, std::memory_order_acquire);
+            }
+            sender_waiting_.store(false, std::memory_order_relaxed);
+            if (!popped) {
+                continue;
+            }
+        }
+        const uint64_t send_start_ns = steady_now_ns();
+        const HakoPduErrorType err = dst_->send(current.key, current.payload);
+        const uint64_t send_usec = (steady_now_ns() - send_start_ns) / 1000;
+        if (err != HAKO_PDU_ERR_OK) {
+            send_errors_.fetch_add(1, std::memory_order_relaxed);
+            std::cerr << "ERROR: Async send of " << current.key.robot << " channel " << current.key.channel_id
+                      << " to " << dst_->get_name() << " failed: " << err << std::endl;
+            report_lost(current.feedback, current.now_usec, send_usec);
+            continue;
+        }
+        if (current.feedback && current.feedback->backpressure) {
+            // Payloads queued before the congestion are no probe: their quick
+            // send says nothing about the link now, so only a probe recovers.
+            DestinationBackpressure& backpressure = *current.feedback->backpressure;
+            if (current.probe || !backpressure.congested()) {
+                backpressure.on_send(current.now_usec, true, send_usec);
+            }
+        }
+        current.feedback.reset();
+        const uint64_t latency = steady_now_ns() - current.enqueue_ns;
+        sent_.fetch_add(1, std::memory_order_relaxed);
+        latency_total_ns_.fetch_add(latency, std::memory_order_relaxed);
+        store_max(latency_max_ns_, latency);
+    }
+}
+
+AsyncSenderStats AsyncSender::stats() const
+{
+    AsyncSenderStats out;
+    out.depth = ring_.size();
+    out.max_depth = max_depth_.load(std::memory_order_relaxed);
+    out.enqueued = enqueued_.load(std::memory_order_relaxed);
+    out.sent = sent_.load(std::memory_order_relaxed);
+    out.dropped = dropped_.load(std::memory_order_relaxed);
+    out.send_errors = send_errors_.load(std::memory_order_relaxed);
+    out.latency_total_ns = latency_total_ns_.load(std::memory_order_relaxed);
+    out.latency_max_ns = latency_max_ns_.load(std::memory_order_relaxed);
+    return out;
+}
+
+} // namespace hakoniwa::pdu::bridge
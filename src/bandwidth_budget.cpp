@@ -0,0 +1,85 @@
+#include "hakoniwa/pdu/bridge/bandwidth_budget.hpp"
+#include <algorithm>
+
+namespace hakoniwa::pdu::bridge {
+
+namespace {
+constexpr int64_t kUsecPerSec = 1000 * 1000;
+}
+
+std::optional<TransferPriority> parse_transfer_priority(const std::string& name)
+{
+    if (name == "high") {
+        return TransferPriority::High;
+    }
+    if (name == "normal") {
+        return TransferPriority::Normal;
+    }
+    if (name == "low") {
+        return TransferPriority::Low;
+    }
+    return std::nullopt;
+}
+
+BandwidthBudget::BandwidthBudget(uint64_t bytes_per_sec, uint64_t burst_bytes)
+    : bytes_per_sec_(bytes_per_sec),
+      burst_ubytes_(static_cast<int64_t>(burst_bytes) * kUsecPerSec),
+      tokens_ubytes_(burst_ubytes_) {}
+
+void BandwidthBudget::refill_(uint64_t now_usec)
+{
+    if (!started_) {
+        started_ = true;
+        first_usec_ = now_usec;
+        last_usec_ = now_usec;
+        return;
+    }
+    if (now_usec <= last_usec_) {
+        return; // clock did not advance (or was reset); nothing to add
+    }
+    const int64_t elapsed = static_cast<int64_t>(now_usec - last_usec_);
+    last_usec_ = now_usec;
+    // Refilling from empty (at most one burst of debt) to full takes
+    // 2 * burst / rate; clamp so long idle periods cannot overflow the product.
+    const int64_t rate = static_cast<int64_t>(bytes_per_sec_);
+    const int64_t refill_usec = rate ? 2 * burst_ubytes_ / rate + 1 : 0;
+    tokens_ubytes_ = std::min(burst_ubytes_, tokens_ubytes_ + rate * std::min(elapsed, refill_usec));
+}
+
+BudgetDecision BandwidthBudget::admit(uint64_t now_usec, size_t bytes, TransferPriority priority, bool can_defer)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    refill_(now_usec);
+    const int64_t cost = static_cast<int64_t>(bytes) * kUsecPerSec;
+    if (priority == TransferPriority::High) {
+        tokens_ubytes_ = std::max(tokens_ubytes_ - cost, -burst_ubytes_);
+    }
+    else if (tokens_ubytes_ >= cost) {
+        tokens_ubytes_ -= cost;
+    }
+    else if (priority == TransferPriority::Normal && can_defer) {
+        ++deferred_;
+        return BudgetDecision::Defer;
+    }
+    else {
+        ++dropped_;
+        return BudgetDecision::Drop;
+    }
+    sent_bytes_ += bytes;
+    return BudgetDecision::Send;
+}
+
+BudgetStats BandwidthBudget::stats() const
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    BudgetStats out;
+    out.bytes_per_sec = bytes_per_sec_;
+    out.sent_bytes = sent_bytes_;
+    out.allowance_bytes = static_cast<uint64_t>(burst_ubytes_ / kUsecPerSec) +
+        bytes_per_sec_ * (last_usec_ - first_usec_) / static_cast<uint64_t>(kUsecPerSec);
+    out.deferred = deferred_;
+    out.dropped = dropped_;
+    return out;
+}
+
+} // namespace hakoniwa::pdu::bridge
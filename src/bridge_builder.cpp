@@ -2,6 +2,11 @@
 #include "hakoniwa/pdu/endpoint_container.hpp"
 #include "hakoniwa/pdu/bridge/bridge_core.hpp"
 #include "hakoniwa/pdu/bridge/bridge_build_result.hpp"
+#include "hakoniwa/pdu/bridge/payload_compression.hpp"
+#include "hakoniwa/pdu/bridge/async_sender.hpp"
+#include "hakoniwa/pdu/bridge/bandwidth_budget.hpp"
+#include "hakoniwa/pdu/bridge/destination_backpressure.hpp"
+#include "hakoniwa/pdu/bridge/destination_presence.hpp"
 #include "hakoniwa/pdu/bridge/policy/immediate_policy.hpp"
 #include "hakoniwa/pdu/bridge/policy/throttle_policy.hpp"
 #include "hakoniwa/pdu/bridge/policy/ticker_policy.hpp"
@@ -11,8 +16,10 @@
 
 #include <nlohmann/json.hpp> // nlohmann/json
 
+#include <algorithm>
 #include <fstream>
 #include <filesystem>
+#include <iostream>
 namespace fs = std::filesystem;
 
 namespace hakoniwa::pdu::bridge {
@@ -47,9 +54,204 @@ namespace hakoniwa::pdu::bridge {
             return std::nullopt;
         }
     }
+    // Number of ticker instances created per phaseSpread policy on this node.
+    // Each instance then gets an evenly spaced offset within the interval.
+    std::map<std::string, size_t> count_phase_spread_instances(
+        const BridgeConfig& bridge_config,
+        const std::string& node_name)
+    {
+        std::map<std::string, size_t> counts;
+        for (const auto& conn_def : bridge_config.connections) {
+            if (conn_def.nodeId != node_name) {
+                continue;
+            }
+            for (const auto& trans_pdu_def : conn_def.transferPdus) {
+                auto policy_def_it = bridge_config.transferPolicies.find(trans_pdu_def.policyId);
+                auto key_group_it = bridge_config.pduKeyGroups.find(trans_pdu_def.pduKeyGroupId);
+                if (policy_def_it == bridge_config.transferPolicies.end() ||
+                    key_group_it == bridge_config.pduKeyGroups.end()) {
+                    continue; // reported by build()
+                }
+                const auto& policy_def = policy_def_it->second;
+                if (policy_def.type != "ticker" || !policy_def.phaseSpread.value_or(false)) {
+                    continue;
+                }
+                counts[trans_pdu_def.policyId] += conn_def.destinations.size() * key_group_it->second.size();
+            }
+        }
+        return counts;
+    }
+    // Resolves a destination's compression config; an absent config means none.
+    std::optional<CompressionSettings> create_compression_settings(
+        const std::optional<CompressionConfig>& config,
+        std::string& error_message)
+    {
+        CompressionSettings settings;
+        if (!config) {
+            return settings;
+        }
+        auto algorithm = parse_compression_algorithm(config->algorithm);
+        if (!algorithm) {
+            error_message = "BridgeLoader: Unknown compression algorithm: " + config->algorithm;
+            return std::nullopt;
+        }
+        if (!compression_available(*algorithm)) {
+            error_message = std::string("BridgeLoader: compression algorithm not available in this build: ") +
+                compression_algorithm_name(*algorithm);
+            return std::nullopt;
+        }
+        if (config->minBytes && *config->minBytes < 0) {
+            error_message = "BridgeLoader: compression minBytes must be >= 0";
+            return std::nullopt;
+        }
+        settings.algorithm = *algorithm;
+        settings.level = config->level.value_or(0);
+        if (config->minBytes) {
+            settings.min_bytes = static_cast<size_t>(*config->minBytes);
+        }
+        return settings;
+    }
+    // Resolves a destination's bandwidth config; returns false on an invalid
+    // one and leaves out_budget empty when there is no budget.
+    bool create_bandwidth_budget(
+        const std::optional<BandwidthConfig>& config,
+        std::shared_ptr<BandwidthBudget>& out_budget,
+        std::string& error_message)
+    {
+        out_budget.reset();
+        if (!config) {
+            return true;
+        }
+        if (config->bytesPerSec <= 0) {
+            error_message = "BridgeLoader: bandwidth bytesPerSec must be > 0";
+            return false;
+        }
+        // 100 ms worth of traffic absorbs a typical cycle's burst.
+        const int64_t burst = config->burstBytes.value_or(std::max<int64_t>(config->bytesPerSec / 10, 1));
+        if (burst <= 0) {
+            error_message = "BridgeLoader: bandwidth burstBytes must be > 0";
+            return false;
+        }
+        out_budget = std::make_shared<BandwidthBudget>(
+            static_cast<uint64_t>(config->bytesPerSec), static_cast<uint64_t>(burst));
+        return true;
+    }
+    // Resolves a destination's async send config; std::nullopt on an invalid one.
+    std::optional<AsyncSendSettings> create_async_send_settings(
+        const AsyncSendConfig& config,
+        std::string& error_message)
+    {
+        AsyncSendSettings settings;
+        if (config.depth) {
+            if (*config.depth < 1) {
+                error_message = "BridgeLoader: async depth must be >= 1";
+                return std::nullopt;
+            }
+            settings.depth = static_cast<size_t>(*config.depth);
+        }
+        if (config.overflow) {
+            auto overflow = parse_async_overflow_policy(*config.overflow);
+            if (!overflow) {
+                error_message = "BridgeLoader: Unknown async overflow policy: " + *config.overflow;
+                return std::nullopt;
+            }
+            settings.overflow = *overflow;
+        }
+        return settings;
+    }
+    // Resolves a destination's backpressure config; returns false on an
+    // invalid one and leaves out_backpressure empty when there is none.
+    bool create_backpressure(
+        const std::string& endpoint_id,
+        const std::optional<BackpressureConfig>& config,
+        std::shared_ptr<DestinationBackpressure>& out_backpressure,
+        std::string& error_message)
+    {
+        out_backpressure.reset();
+        if (!config) {
+            return true;
+        }
+        BackpressureSettings settings;
+        if (config->slowSendUsec) {
+            if (*config->slowSendUsec < 0) {
+                error_message = "BridgeLoader: backpressure slowSendUsec must be >= 0";
+                return false;
+            }
+            settings.slow_send_usec = static_cast<uint64_t>(*config->slowSendUsec);
+        }
+        if (config->probeIntervalMs) {
+            if (*config->probeIntervalMs < 1) {
+                error_message = "BridgeLoader: backpressure probeIntervalMs must be >= 1";
+                return false;
+            }
+            settings.probe_interval_usec = static_cast<uint64_t>(*config->probeIntervalMs) * 1000;
+        }
+        out_backpressure = std::make_shared<DestinationBackpressure>(endpoint_id, settings);
+        return true;
+    }
+    // Applies the bridge-level polling config. Endpoints missing from this
+    // node's container are skipped, since the config is shared by all nodes.
+    bool configure_polling(BridgeCore& core, const std::optional<PollingConfig>& config, std::string& error_message)
+    {
+        if (!config) {
+            return true;
+        }
+        PollingSettings settings;
+        if (config->idleAfterMs) {
+            if (*config->idleAfterMs < 1) {
+                error_message = "BridgeLoader: polling idleAfterMs must be >= 1";
+                return false;
+            }
+            settings.idle_after_usec = static_cast<uint64_t>(*config->idleAfterMs) * 1000;
+        }
+        if (config->maxIntervalMs) {
+            if (*config->maxIntervalMs < 1) {
+                error_message = "BridgeLoader: polling maxIntervalMs must be >= 1";
+                return false;
+            }
+            settings.max_interval_usec = static_cast<uint64_t>(*config->maxIntervalMs) * 1000;
+        }
+        core.set_polling_settings(settings);
+        for (const auto& [endpoint_id, mode_name] : config->endpoints) {
+            const auto mode = parse_endpoint_polling(mode_name);
+            if (!mode) {
+                error_message = "BridgeLoader: Unknown polling mode for " + endpoint_id + ": " + mode_name;
+                return false;
+            }
+            if (!core.set_endpoint_polling(endpoint_id, *mode)) {
+                std::cerr << "WARNING: BridgeLoader: polling endpoint not on this node: " << endpoint_id << std::endl;
+            }
+        }
+        return true;
+    }
+    bool configure_workers(BridgeCore& core, const std::optional<WorkersConfig>& config, std::string& error_message)
+    {
+        if (!config) {
+            return true;
+        }
+        WorkerPoolSettings settings;
+        const int threads = config->threads.value_or(1);
+        if (threads < 1) {
+            error_message = "BridgeLoader: workers threads must be >= 1";
+            return false;
+        }
+        settings.threads = static_cast<size_t>(threads);
+        for (int cpu : config->cpuAffinity) {
+            if (cpu < 0) {
+                error_message = "BridgeLoader: workers cpuAffinity entries must be >= 0";
+                return false;
+            }
+        }
+        settings.cpu_affinity = config->cpuAffinity;
+        core.set_worker_pool(settings);
+        return true;
+    }
+    // Frames per keyframe when a delta "encode" policy does not set one.
+    constexpr int kDefaultDeltaKeyframeInterval = 30;
     std::shared_ptr<IPduTransferPolicy> create_policy_instance(
         const TransferPolicy& policy_def,
-        std::string& error_message)
+        std::string& error_message,
+        uint64_t phase_offset_usec = 0)
     {
         if (policy_def.type == "immediate") {
             bool is_atomic = policy_def.atomic.value_or(false);
@@ -60,14 +262,31 @@ namespace hakoniwa::pdu::bridge {
                 error_message = "BridgeLoader: throttle policy needs intervalMs";
                 return nullptr;
             }
-            return std::make_shared<ThrottlePolicy>(static_cast<uint64_t>(*policy_def.intervalMs) * 1000);
+            return std::make_shared<ThrottlePolicy>(static_cast<uint64_t>(*policy_def.intervalMs) * 1000, policy_def.trailing.value_or(false));
         }
         if (policy_def.type == "ticker") {
             if (!policy_def.intervalMs) {
                 error_message = "BridgeLoader: ticker policy needs intervalMs";
                 return nullptr;
             }
-            return std::make_shared<TickerPolicy>(static_cast<uint64_t>(*policy_def.intervalMs) * 1000);
+            TickerSchedule schedule;
+            schedule.fixed_rate = policy_def.fixedRate.value_or(false);
+            schedule.only_if_updated = policy_def.onlyIfUpdated.value_or(false);
+            const std::string catch_up = policy_def.catchUp.value_or("skip");
+            if (catch_up == "burst") {
+                schedule.catch_up = TickerCatchUp::Burst;
+            } else if (catch_up != "skip") {
+                error_message = "BridgeLoader: Unknown ticker catchUp: " + catch_up;
+                return nullptr;
+            }
+            if (policy_def.maxBurst) {
+                if (*policy_def.maxBurst < 1) {
+                    error_message = "BridgeLoader: ticker maxBurst must be >= 1";
+                    return nullptr;
+                }
+                schedule.max_burst = static_cast<uint32_t>(*policy_def.maxBurst);
+            }
+            return std::make_shared<TickerPolicy>(static_cast<uint64_t>(*policy_def.intervalMs) * 1000, phase_offset_usec, schedule);
         }
         error_message = "BridgeLoader: Unknown transfer policy type: " + policy_def.type;
         return nullptr;
@@ -93,6 +312,8 @@ namespace hakoniwa::pdu::bridge {
             return result;
         }
         const BridgeConfig& bridge_config = *maybe_config;
+        const auto phase_spread_counts = count_phase_spread_instances(bridge_config, node_name);
+        std::map<std::string, size_t> phase_spread_next;
 
         /*
          * bridge core creation
@@ -102,6 +323,12 @@ namespace hakoniwa::pdu::bridge {
             time_source,
             endpoint_container
         );
+        if (!configure_polling(*core, bridge_config.polling, result.error_message)) {
+            return result;
+        }
+        if (!configure_workers(*core, bridge_config.workers, result.error_message)) {
+            return result;
+        }
 
         /*
          * TransferPdu && connection section
@@ -117,6 +344,8 @@ namespace hakoniwa::pdu::bridge {
                 return result;
             }
             auto connection = std::make_unique<BridgeConnection>(conn_def.nodeId, conn_def.id, epoch_validation, src_ep);
+            // Shared by every connection reading this endpoint so each source PDU is read once per trigger.
+            auto src_snapshot = core->source_snapshot(src_ep);
             for (const auto& trans_pdu_def : conn_def.transferPdus) {
                 auto key_group_it = bridge_config.pduKeyGroups.find(trans_pdu_def.pduKeyGroupId);
                 if (key_group_it == bridge_config.pduKeyGroups.end()) {
@@ -137,6 +366,72 @@ namespace hakoniwa::pdu::bridge {
                     result.error_message = "BridgeLoader: Destination endpoint not found: " + dest_def.endpointId;
                     return result;
                 }
+                auto compression = create_compression_settings(
+                    dest_def.compression ? dest_def.compression : conn_def.compression, result.error_message);
+                if (!compression) {
+                    return result;
+                }
+                const bool decompress = conn_def.source.decompress.value_or(false);
+                const bool unbatch = conn_def.source.unbatch.value_or(false);
+                // With batching, compression applies to the batch frame rather
+                // than to each PDU inside it.
+                std::shared_ptr<PduBatch> batch;
+                if (conn_def.batch) {
+                    const hakoniwa::pdu::PduKey carrier{conn_def.batch->robot_name, conn_def.batch->pdu_name};
+                    const int carrier_channel = dst_ep->get_pdu_channel_id(carrier);
+                    if (carrier_channel < 0) {
+                        result.error_message = "BridgeLoader: batch carrier PDU not defined on destination " +
+                            dest_def.endpointId + ": " + carrier.robot + "." + carrier.pdu;
+                        return result;
+                    }
+                    batch = std::make_shared<PduBatch>(
+                        dst_ep, hakoniwa::pdu::PduResolvedKey{carrier.robot, carrier_channel},
+                        dst_ep->get_pdu_size(carrier), *compression);
+                    connection->add_batch(batch);
+                    compression = CompressionSettings{};
+                }
+                std::shared_ptr<BandwidthBudget> budget;
+                if (!create_bandwidth_budget(dest_def.bandwidth ? dest_def.bandwidth : conn_def.bandwidth,
+                        budget, result.error_message)) {
+                    return result;
+                }
+                if (budget) {
+                    connection->add_budget(budget);
+                }
+                std::shared_ptr<AsyncSender> async_sender;
+                if (dest_def.async) {
+                    auto settings = create_async_send_settings(*dest_def.async, result.error_message);
+                    if (!settings) {
+                        return result;
+                    }
+                    std::string error;
+                    async_sender = core->async_sender(dst_ep, *settings, error);
+                    if (!async_sender) {
+                        result.error_message = "BridgeLoader: " + error;
+                        return result;
+                    }
+                    connection->add_async_sender(async_sender);
+                    if (batch) {
+                        batch->set_async_sender(async_sender);
+                    }
+                }
+                std::shared_ptr<DestinationBackpressure> backpressure;
+                if (!create_backpressure(dest_def.endpointId,
+                        dest_def.backpressure ? dest_def.backpressure : conn_def.backpressure,
+                        backpressure, result.error_message)) {
+                    return result;
+                }
+                if (backpressure) {
+                    connection->add_backpressure(backpressure);
+                    if (batch) {
+                        batch->set_backpressure(backpressure);
+                    }
+                }
+                std::shared_ptr<DestinationPresence> presence;
+                if (dest_def.lateJoin.value_or(conn_def.lateJoin.value_or(false))) {
+                    presence = std::make_shared<DestinationPresence>(dest_def.endpointId, dst_ep);
+                    connection->add_presence(presence);
+                }
 
                 for (const auto& trans_pdu_def : conn_def.transferPdus) {
                     auto policy_def_it = bridge_config.transferPolicies.find(trans_pdu_def.policyId);
@@ -152,23 +447,86 @@ namespace hakoniwa::pdu::bridge {
                         return result;
                     }
                     const auto& pdu_keys = key_group_it->second;
+                    const auto& priority_name = trans_pdu_def.priority ? trans_pdu_def.priority : policy_def.priority;
+                    auto priority = priority_name ? parse_transfer_priority(*priority_name) : TransferPriority::Normal;
+                    if (!priority) {
+                        result.error_message = "BridgeLoader: Unknown priority: " + *priority_name;
+                        return result;
+                    }
                     bool is_immediate_atomic = (policy_def.type == "immediate") && policy_def.atomic.value_or(false);
                     if (is_immediate_atomic) {
-                        auto immediate_policy = std::make_shared<ImmediatePolicy>(true);
-                        for (const auto& pdu_key_def : pdu_keys) {
-                            auto channel_id = src_ep->get_pdu_channel_id({pdu_key_def.robot_name, pdu_key_def.pdu_name});
-                            immediate_policy->add_pdu_key({pdu_key_def.robot_name, channel_id});
+                        if (policy_def.dedupe.value_or(false)) {
+                            result.error_message = "BridgeLoader: dedupe is not supported for atomic policy: " + trans_pdu_def.policyId;
+                            return result;
                         }
-                        auto transfer_group = std::make_unique<TransferAtomicPduGroup>(pdu_keys, immediate_policy, time_source, src_ep, dst_ep);
+                        if (policy_def.delta) {
+                            result.error_message = "BridgeLoader: delta is not supported for atomic policy: " + trans_pdu_def.policyId;
+                            return result;
+                        }
+                        // The group registers its members with the policy.
+                        auto immediate_policy = std::make_shared<ImmediatePolicy>(true, src_snapshot->keys());
+                        auto transfer_group = std::make_unique<TransferAtomicPduGroup>(pdu_keys, immediate_policy, core->cycle_clock(), src_snapshot, dst_ep);
+                        transfer_group->enable_compression(*compression);
+                        if (decompress) {
+                            transfer_group->enable_decompression();
+                        }
+                        transfer_group->set_budget(budget);
+                        transfer_group->set_priority(*priority);
                         connection->add_transfer_pdu(std::move(transfer_group));
                     } else {
                         for (const auto& pdu_key_def : pdu_keys) {
+                            uint64_t phase_offset_usec = 0;
+                            if (auto it = phase_spread_counts.find(trans_pdu_def.policyId); it != phase_spread_counts.end()) {
+                                const uint64_t interval_usec = static_cast<uint64_t>(*policy_def.intervalMs) * 1000;
+                                phase_offset_usec = interval_usec * phase_spread_next[trans_pdu_def.policyId]++ / it->second;
+                            }
                             // Create transfer policy per transfer instance (no sharing across PDUs/destinations).
-                            auto policy = create_policy_instance(policy_def, result.error_message);
+                            auto policy = create_policy_instance(policy_def, result.error_message, phase_offset_usec);
                             if (!policy) {
                                 return result;
                             }
-                            auto transfer_pdu = std::make_unique<TransferPdu>(pdu_key_def, policy, time_source, src_ep, dst_ep);
+                            auto transfer_pdu = std::make_unique<TransferPdu>(pdu_key_def, policy, core->cycle_clock(), src_snapshot, dst_ep);
+                            if (policy_def.dedupe.value_or(false)) {
+                                transfer_pdu->enable_dedupe(static_cast<uint64_t>(policy_def.dedupeRefreshMs.value_or(0)) * 1000);
+                            }
+                            transfer_pdu->enable_compression(*compression);
+                            if (decompress) {
+                                transfer_pdu->enable_decompression();
+                            }
+                            if (batch) {
+                                if (policy_def.delta == "encode") {
+                                    result.error_message = "BridgeLoader: delta encode cannot be combined with batch: " + conn_def.id;
+                                    return result;
+                                }
+                                // A record counts as written once it is queued on the
+                                // frame, so a failed frame send would be suppressed.
+                                if (policy_def.dedupe.value_or(false)) {
+                                    result.error_message = "BridgeLoader: dedupe cannot be combined with batch: " + conn_def.id;
+                                    return result;
+                                }
+                                transfer_pdu->set_batch(batch);
+                            }
+                            if (unbatch) {
+                                transfer_pdu->enable_unbatch();
+                            }
+                            transfer_pdu->set_budget(budget);
+                            transfer_pdu->set_async_sender(async_sender);
+                            transfer_pdu->set_backpressure(backpressure);
+                            transfer_pdu->set_presence(presence);
+                            transfer_pdu->set_priority(*priority);
+                            if (policy_def.delta == "encode") {
+                                const int interval = policy_def.deltaKeyframeInterval.value_or(kDefaultDeltaKeyframeInterval);
+                                if (interval < 1) {
+                                    result.error_message = "BridgeLoader: deltaKeyframeInterval must be >= 1: " + trans_pdu_def.policyId;
+                                    return result;
+                                }
+                                transfer_pdu->enable_delta_encode(static_cast<uint32_t>(interval));
+                            } else if (policy_def.delta == "decode") {
+                                transfer_pdu->enable_delta_decode();
+                            } else if (policy_def.delta) {
+                                result.error_message = "BridgeLoader: Unknown delta mode: " + *policy_def.delta;
+                                return result;
+                            }
                             connection->add_transfer_pdu(std::move(transfer_pdu));
                         }
                     }
@@ -1,21 +1,39 @@
 #include "hakoniwa/pdu/bridge/bridge_connection.hpp"
-#include "hakoniwa/time_source/time_source.hpp" // For ITimeSource
+#include <algorithm>
+#include <utility>
 
 namespace hakoniwa::pdu::bridge {
 
+BridgeConnection::~BridgeConnection() {
+    // No reader can be left once the connection itself goes away.
+    list_.store(nullptr, std::memory_order_seq_cst);
+    list_owner_.reset();
+    reclaim_.reclaim();
+}
+
+template <typename Edit>
+void BridgeConnection::update_list_(Edit&& edit) {
+    auto next = std::make_shared<TransferList>(*list_owner_);
+    edit(*next);
+    next->version = list_owner_->version + 1;
+    list_.store(next.get(), std::memory_order_seq_cst);
+    reclaim_.retire(std::exchange(list_owner_, std::move(next)));
+    reclaim_.reclaim();
+}
+
 void BridgeConnection::add_transfer_pdu(std::unique_ptr<ITransferPdu> pdu) {
-    std::lock_guard<std::mutex> lock(transfer_mtx_);
-    pdu->set_epoch(epoch_.load(std::memory_order_relaxed));
-    pdu->set_epoch_validation(epoch_validation_);
-    transfer_pdus_.push_back(std::move(pdu));
+    add_monitor_transfer_pdu(std::move(pdu));
 }
 
 ITransferPdu* BridgeConnection::add_monitor_transfer_pdu(std::unique_ptr<ITransferPdu> pdu) {
-    std::lock_guard<std::mutex> lock(transfer_mtx_);
+    std::lock_guard<std::mutex> lock(writer_mtx_);
     pdu->set_epoch(epoch_.load(std::memory_order_relaxed));
     pdu->set_epoch_validation(epoch_validation_);
+    pdu->set_deadline_notifier(&deadlines_changed_);
     ITransferPdu* handle = pdu.get();
+    const uint64_t seq = next_seq_++;
     transfer_pdus_.push_back(std::move(pdu));
+    update_list_([handle, seq](TransferList& list) { list.transfers.push_back(ScheduledTransfer{handle, seq}); });
     return handle;
 }
 
@@ -23,7 +41,7 @@ bool BridgeConnection::remove_transfer_pdu(ITransferPdu* transfer) {
     if (!transfer) {
         return false;
     }
-    std::lock_guard<std::mutex> lock(transfer_mtx_);
+    std::lock_guard<std::mutex> lock(writer_mtx_);
     auto it = std::find_if(
         transfer_pdus_.begin(),
         transfer_pdus_.end(),
@@ -31,37 +49,238 @@ bool BridgeConnection::remove_transfer_pdu(ITransferPdu* transfer) {
     if (it == transfer_pdus_.end()) {
         return false;
     }
+    // A trigger still holding the old list may call it once more; inactive,
+    // it does nothing.
+    transfer->set_active(false);
+    std::shared_ptr<const void> retired(std::move(*it));
     transfer_pdus_.erase(it);
+    update_list_([transfer](TransferList& list) {
+        list.transfers.erase(std::find_if(list.transfers.begin(), list.transfers.end(),
+            [transfer](const ScheduledTransfer& t) { return t.transfer == transfer; }));
+    });
+    reclaim_.retire(std::move(retired));
+    reclaim_.reclaim();
     return true;
 }
 
 void BridgeConnection::set_active(bool is_active) {
-    std::lock_guard<std::mutex> lock(transfer_mtx_);
-    is_active_ = is_active;
+    std::lock_guard<std::mutex> lock(writer_mtx_);
+    is_active_.store(is_active, std::memory_order_release);
     for (auto& pdu : transfer_pdus_) {
         pdu->set_active(is_active);
     }
 }
 
 void BridgeConnection::increment_epoch() {
-    std::lock_guard<std::mutex> lock(transfer_mtx_);
+    std::lock_guard<std::mutex> lock(writer_mtx_);
     uint8_t new_epoch = epoch_.fetch_add(1, std::memory_order_relaxed) + 1;
     for (auto& pdu : transfer_pdus_) {
         pdu->set_epoch(new_epoch);
     }
 }
 
-void BridgeConnection::cyclic_trigger() {
-    std::lock_guard<std::mutex> lock(transfer_mtx_);
+void BridgeConnection::sync_scheduler_(const TransferList& list) const {
+    if (list.version != scheduled_version_) {
+        scheduler_.sync(list.transfers);
+        scheduled_version_ = list.version;
+    }
+    if (deadlines_changed_.exchange(false, std::memory_order_acq_rel)) {
+        scheduler_.resync();
+    }
+}
+
+void BridgeConnection::cyclic_trigger(const CycleContext& ctx) {
+    if (!is_active_.load(std::memory_order_acquire)) {
+        return;
+    }
+    run_due_(ctx);
+    // Frees what a burst of detaches left behind while this trigger was
+    // pinned, instead of waiting for the next control-plane write.
+    reclaim_.try_reclaim();
+}
+
+void BridgeConnection::run_due_(const CycleContext& ctx) {
+    const auto guard = reclaim_.pin();
+    const TransferList& list = *list_.load(std::memory_order_seq_cst);
     #ifdef ENABLE_DEBUG_MESSAGES
-    std::cout << "DEBUG: BridgeConnection cyclic_trigger called. size=" << transfer_pdus_.size() << std::endl;
+    std::cout << "DEBUG: BridgeConnection cyclic_trigger called. size=" << list.transfers.size() << std::endl;
     #endif
-    if (!is_active_) {
-        return;
+    std::lock_guard<std::mutex> lock(trigger_mtx_);
+    bool joined = false;
+    for (const auto& presence : list.presences) {
+        joined |= presence->poll();
     }
-    for (auto& pdu : transfer_pdus_) {
-        pdu->cyclic_trigger();
+    if (joined) {
+        // Transfers to destinations that did not join have nothing to replay.
+        for (const auto& t : list.transfers) {
+            t.transfer->replay_latest(ctx);
+        }
+    }
+    sync_scheduler_(list);
+    scheduler_.run_due(ctx);
+    bool recovered = false;
+    for (const auto& backpressure : list.backpressures) {
+        recovered |= backpressure->take_recovered();
+    }
+    if (recovered) {
+        // Transfers of destinations that are still congested keep holding.
+        for (const auto& t : list.transfers) {
+            t.transfer->flush_coalesced(ctx);
+        }
+    }
+    for (const auto& batch : list.batches) {
+        batch->flush(ctx.now_usec);
+    }
+}
+
+void BridgeConnection::add_batch(std::shared_ptr<PduBatch> batch) {
+    std::lock_guard<std::mutex> lock(writer_mtx_);
+    update_list_([&batch](TransferList& list) { list.batches.push_back(std::move(batch)); });
+}
+
+bool BridgeConnection::has_batches() const {
+    const auto guard = reclaim_.pin();
+    return !list_.load(std::memory_order_seq_cst)->batches.empty();
+}
+
+uint64_t BridgeConnection::batch_frames_sent() const {
+    const auto guard = reclaim_.pin();
+    uint64_t total = 0;
+    for (const auto& batch : list_.load(std::memory_order_seq_cst)->batches) {
+        total += batch->frames_sent();
+    }
+    return total;
+}
+
+uint64_t BridgeConnection::batch_records_sent() const {
+    const auto guard = reclaim_.pin();
+    uint64_t total = 0;
+    for (const auto& batch : list_.load(std::memory_order_seq_cst)->batches) {
+        total += batch->records_sent();
+    }
+    return total;
+}
+
+void BridgeConnection::add_budget(std::shared_ptr<BandwidthBudget> budget) {
+    std::lock_guard<std::mutex> lock(writer_mtx_);
+    update_list_([&budget](TransferList& list) { list.budgets.push_back(std::move(budget)); });
+}
+
+bool BridgeConnection::has_budgets() const {
+    const auto guard = reclaim_.pin();
+    return !list_.load(std::memory_order_seq_cst)->budgets.empty();
+}
+
+BudgetStats BridgeConnection::budget_stats() const {
+    const auto guard = reclaim_.pin();
+    BudgetStats total;
+    for (const auto& budget : list_.load(std::memory_order_seq_cst)->budgets) {
+        const BudgetStats stats = budget->stats();
+        total.bytes_per_sec += stats.bytes_per_sec;
+        total.sent_bytes += stats.sent_bytes;
+        total.allowance_bytes += stats.allowance_bytes;
+        total.deferred += stats.deferred;
+        total.dropped += stats.dropped;
+    }
+    return total;
+}
+
+void BridgeConnection::add_async_sender(std::shared_ptr<AsyncSender> sender) {
+    std::lock_guard<std::mutex> lock(writer_mtx_);
+    const auto& senders = list_owner_->async_senders;
+    if (std::find(senders.begin(), senders.end(), sender) == senders.end()) {
+        update_list_([&sender](TransferList& list) { list.async_senders.push_back(std::move(sender)); });
+    }
+}
+
+bool BridgeConnection::has_async_senders() const {
+    const auto guard = reclaim_.pin();
+    return !list_.load(std::memory_order_seq_cst)->async_senders.empty();
+}
+
+AsyncSenderStats BridgeConnection::async_sender_stats() const {
+    const auto guard = reclaim_.pin();
+    AsyncSenderStats total;
+    for (const auto& sender : list_.load(std::memory_order_seq_cst)->async_senders) {
+        const AsyncSenderStats stats = sender->stats();
+        total.depth += stats.depth;
+        total.max_depth += stats.max_depth;
+        total.enqueued += stats.enqueued;
+        total.sent += stats.sent;
+        total.dropped += stats.dropped;
+        total.send_errors += stats.send_errors;
+        total.latency_total_ns += stats.latency_total_ns;
+        total.latency_max_ns = std::max(total.latency_max_ns, stats.latency_max_ns);
+    }
+    return total;
+}
+
+void BridgeConnection::add_backpressure(std::shared_ptr<DestinationBackpressure> backpressure) {
+    std::lock_guard<std::mutex> lock(writer_mtx_);
+    update_list_([&backpressure](TransferList& list) { list.backpressures.push_back(std::move(backpressure)); });
+}
+
+bool BridgeConnection::has_backpressure() const {
+    const auto guard = reclaim_.pin();
+    return !list_.load(std::memory_order_seq_cst)->backpressures.empty();
+}
+
+std::vector<std::pair<std::string, BackpressureStats>> BridgeConnection::backpressure_stats() const {
+    const auto guard = reclaim_.pin();
+    const TransferList& list = *list_.load(std::memory_order_seq_cst);
+    std::vector<std::pair<std::string, BackpressureStats>> out;
+    out.reserve(list.backpressures.size());
+    for (const auto& backpressure : list.backpressures) {
+        out.emplace_back(backpressure->endpoint_id(), backpressure->stats());
+    }
+    return out;
+}
+
+void BridgeConnection::add_presence(std::shared_ptr<DestinationPresence> presence) {
+    std::lock_guard<std::mutex> lock(writer_mtx_);
+    update_list_([&presence](TransferList& list) { list.presences.push_back(std::move(presence)); });
+}
+
+bool BridgeConnection::has_presence() const {
+    const auto guard = reclaim_.pin();
+    return !list_.load(std::memory_order_seq_cst)->presences.empty();
+}
+
+PresenceStats BridgeConnection::presence_stats() const {
+    const auto guard = reclaim_.pin();
+    PresenceStats total;
+    for (const auto& presence : list_.load(std::memory_order_seq_cst)->presences) {
+        const PresenceStats stats = presence->stats();
+        total.running |= stats.running;
+        total.joins += stats.joins;
+        total.replays += stats.replays;
+    }
+    return total;
+}
+
+TransferCounters BridgeConnection::transfer_counters(const PduKeyId& key) const {
+    const auto guard = reclaim_.pin();
+    TransferCounters counters;
+    for (const auto& t : list_.load(std::memory_order_seq_cst)->transfers) {
+        t.transfer->accumulate_counters(key, counters);
+    }
+    return counters;
+}
+
+uint64_t BridgeConnection::next_deadline_usec() const {
+    if (!is_active_.load(std::memory_order_acquire)) {
+        return kNoDeadline;
+    }
+    const auto guard = reclaim_.pin();
+    const TransferList& list = *list_.load(std::memory_order_seq_cst);
+    for (const auto& backpressure : list.backpressures) {
+        if (backpressure->recovery_pending()) {
+            return 0; // held-back values are flushed on the next trigger
+        }
     }
+    std::lock_guard<std::mutex> lock(trigger_mtx_);
+    sync_scheduler_(list);
+    return scheduler_.next_deadline_usec();
 }
 
 } // namespace hakoniwa::pdu::bridge
@@ -12,13 +12,44 @@
 namespace hakoniwa::pdu::bridge {
 
 BridgeCore::BridgeCore(const std::string& node_name, std::shared_ptr<hakoniwa::time_source::ITimeSource> time_source, std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container) 
-    : node_name_(node_name), is_running_(false), time_source_(time_source), endpoint_container_(endpoint_container) {
+    : node_name_(node_name), keys_(std::make_shared<KeyRegistry>()), wakeup_(std::make_shared<CycleWakeup>()), is_running_(false), time_source_(time_source),
+      cycle_clock_(std::make_shared<CycleClock>(time_source)), endpoint_container_(endpoint_container),
+      timing_(time_source ? time_source->get_delta_time_microseconds() : 0) {
     endpoint_ids_ = endpoint_container_->list_endpoint_ids();
+    // Resolve once; cyclic_trigger() must not look endpoints up by name.
+    for (const auto& endpoint_id : endpoint_ids_) {
+        poller_.add_endpoint(endpoint_id, endpoint_container_->ref(endpoint_id));
+    }
+    set_polling_settings({});
+}
+
+void BridgeCore::set_polling_settings(PollingSettings settings)
+{
+    if (settings.min_interval_usec == 0 && time_source_) {
+        settings.min_interval_usec = time_source_->get_delta_time_microseconds();
+    }
+    poller_.set_settings(settings);
+}
+
+void BridgeCore::set_worker_pool(const WorkerPoolSettings& settings)
+{
+    if (settings.threads <= 1) {
+        workers_.reset();
+        return;
+    }
+    workers_ = std::make_unique<CycleWorkerPool>(settings);
+}
+
+WorkerPoolStats BridgeCore::worker_pool_stats() const
+{
+    return workers_ ? workers_->stats() : WorkerPoolStats{};
 }
 
 void BridgeCore::add_connection(std::unique_ptr<BridgeConnection> connection) {
     if (connection) {
-        connection_transferable_pdus_.try_emplace(connection->getConnectionId());
+        const NameId id = keys_->intern(connection->getConnectionId());
+        connection_index_.try_emplace(id, connections_.size());
+        connection_transferable_pdus_.try_emplace(id);
     }
     connections_.push_back(std::move(connection));
 }
@@ -31,14 +62,67 @@ void BridgeCore::register_connection_transfer_pdu_key(
     if (connection_id.empty() || robot.empty() || pdu_name.empty()) {
         return;
     }
-    auto& keys = connection_transferable_pdus_[connection_id];
-    const auto key = std::make_pair(robot, pdu_name);
+    auto& keys = connection_transferable_pdus_[keys_->intern(connection_id)];
+    const auto key = keys_->intern_pdu(robot, pdu_name);
     const auto exists = std::find(keys.begin(), keys.end(), key) != keys.end();
     if (!exists) {
         keys.push_back(key);
     }
 }
 
+std::shared_ptr<SourceSnapshot> BridgeCore::source_snapshot(const std::shared_ptr<hakoniwa::pdu::Endpoint>& endpoint)
+{
+    if (!endpoint) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(source_snapshots_mtx_);
+    for (const auto& snapshot : source_snapshots_) {
+        if (snapshot->endpoint() == endpoint) {
+            return snapshot;
+        }
+    }
+    auto snapshot = std::make_shared<SourceSnapshot>(endpoint, keys_, wakeup_);
+    source_snapshots_.push_back(snapshot);
+    poller_.attach_snapshot(snapshot);
+    return snapshot;
+}
+
+std::shared_ptr<AsyncSender> BridgeCore::async_sender(
+    const std::shared_ptr<hakoniwa::pdu::Endpoint>& endpoint,
+    const AsyncSendSettings& settings,
+    std::string& error)
+{
+    if (!endpoint) {
+        error = "async sender requires a destination endpoint";
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(async_senders_mtx_);
+    for (const auto& sender : async_senders_) {
+        if (sender->endpoint() == endpoint) {
+            if (!(sender->settings() == settings)) {
+                error = "conflicting async settings for destination " + endpoint->get_name();
+                return nullptr;
+            }
+            return sender;
+        }
+    }
+    auto sender = std::make_shared<AsyncSender>(endpoint, settings);
+    async_senders_.push_back(sender);
+    return sender;
+}
+
+std::shared_ptr<SourceSnapshot> BridgeCore::find_source_snapshot_(
+    const std::shared_ptr<hakoniwa::pdu::Endpoint>& endpoint) const
+{
+    std::lock_guard<std::mutex> lock(source_snapshots_mtx_);
+    for (const auto& snapshot : source_snapshots_) {
+        if (snapshot->endpoint() == endpoint) {
+            return snapshot;
+        }
+    }
+    return nullptr;
+}
+
 void BridgeCore::start() {
     if (is_running_.exchange(true)) {
         // Already running in another thread.
@@ -57,19 +141,35 @@ bool BridgeCore::cyclic_trigger() {
         // Not running, so do nothing.
         return false;
     }
-    // Trigger recv events for hakoniwa polling shm endpoints
-    for (const auto& endpoint_id : endpoint_ids_) {
-        auto endpoint = endpoint_container_->ref(endpoint_id);
-        if (endpoint) {
-            endpoint->process_recv_events();
+    timing_.begin(CycleTiming::Clock::now());
+    // Read the time source once for everything evaluated in this trigger,
+    // including receive events polled below when the event clock is Cycle.
+    const CycleContext ctx = cycle_clock_->begin_cycle();
+    // Start a new read-once window before any event or cyclic transfer reads.
+    {
+        std::lock_guard<std::mutex> lock(source_snapshots_mtx_);
+        for (const auto& snapshot : source_snapshots_) {
+            snapshot->begin_cycle();
         }
     }
+    // Trigger recv events for hakoniwa polling shm endpoints
+    poller_.poll(ctx);
+    // Events delivered so far are handled by this cycle; later ones wake the
+    // next wait_next_cycle().
+    wakeup_->clear();
     // Trigger cyclic transfers
     #ifdef ENABLE_DEBUG_MESSAGES
     std::cout << "connections_ size: " << connections_.size() << std::endl;
     #endif
-    for (auto& connection : connections_) {
-        connection->cyclic_trigger();
+    if (workers_) {
+        // Connections are independent; run() is the end-of-cycle barrier.
+        workers_->run(connections_.size(), [this, &ctx](size_t i) {
+            connections_[i]->cyclic_trigger(ctx);
+        });
+    } else {
+        for (auto& connection : connections_) {
+            connection->cyclic_trigger(ctx);
+        }
     }
     std::shared_ptr<BridgeMonitorRuntime> runtime;
     {
@@ -79,6 +179,7 @@ bool BridgeCore::cyclic_trigger() {
     if (runtime) {
         runtime->process_control_plane_once();
     }
+    timing_.end(CycleTiming::Clock::now());
     #ifdef ENABLE_DEBUG_MESSAGES
     std::cout << "DEBUG: BridgeCore cyclic_trigger completed." << std::endl;
     #endif
@@ -87,6 +188,7 @@ bool BridgeCore::cyclic_trigger() {
 
 void BridgeCore::stop() {
     is_running_ = false;
+    wakeup_->notify();
     std::shared_ptr<BridgeMonitorRuntime> runtime;
     {
         std::lock_guard<std::mutex> lock(monitor_runtime_mtx_);
@@ -115,34 +217,55 @@ void BridgeCore::detach_monitor_runtime()
     }
 }
 
+bool BridgeCore::wait_next_cycle(uint64_t max_wait_usec)
+{
+    poller_.set_event_loop(true);
+    uint64_t wait_usec = max_wait_usec;
+    const uint64_t deadline = next_deadline_usec();
+    if (deadline != kNoDeadline) {
+        const uint64_t now = time_source_->get_microseconds();
+        // Work due now (an every-cycle poll, a deferred send) keeps the
+        // delta-time pacing of a fixed loop.
+        const uint64_t until = deadline > now ? deadline - now : time_source_->get_delta_time_microseconds();
+        wait_usec = std::min(wait_usec, until);
+    }
+    return wakeup_->wait_for_usec(wait_usec);
+}
+
+uint64_t BridgeCore::next_deadline_usec() const {
+    uint64_t deadline = poller_.next_deadline_usec();
+    for (const auto& connection : connections_) {
+        deadline = std::min(deadline, connection->next_deadline_usec());
+    }
+    return deadline;
+}
+
 bool BridgeCore::set_connection_active(const std::string& connection_id, bool is_active) {
-    for (auto& connection : connections_) {
-        if (connection->getConnectionId() == connection_id) {
-            connection->set_active(is_active);
-            return true;
-        }
+    auto* connection = find_connection_mutable_(connection_id);
+    if (!connection) {
+        return false;
     }
-    return false;
+    connection->set_active(is_active);
+    wakeup_->notify(); // its tickers may be due again
+    return true;
 }
 
 bool BridgeCore::get_connection_epoch(const std::string& connection_id, uint8_t& out_epoch) const {
-    for (const auto& connection : connections_) {
-        if (connection->getConnectionId() == connection_id) {
-            out_epoch = connection->get_epoch();
-            return true;
-        }
+    const auto* connection = find_connection_(connection_id);
+    if (!connection) {
+        return false;
     }
-    return false;
+    out_epoch = connection->get_epoch();
+    return true;
 }
 
 bool BridgeCore::increment_connection_epoch(const std::string& connection_id) {
-    for (auto& connection : connections_) {
-        if (connection->getConnectionId() == connection_id) {
-            connection->increment_epoch();
-            return true;
-        }
+    auto* connection = find_connection_mutable_(connection_id);
+    if (!connection) {
+        return false;
     }
-    return false;
+    connection->increment_epoch();
+    return true;
 }
 
 std::optional<ResolvedMonitorSelection> BridgeCore::resolve_monitor_selection(
@@ -195,10 +318,12 @@ ITransferPdu* BridgeCore::create_monitor_transfer(
     auto transfer = std::make_unique<TransferPdu>(
         monitor_key,
         policy_instance,
-        time_source_,
-        src_endpoint,
+        cycle_clock_,
+        source_snapshot(src_endpoint),
         destination_endpoint);
-    return connection->add_monitor_transfer_pdu(std::move(transfer));
+    auto* added = connection->add_monitor_transfer_pdu(std::move(transfer));
+    wakeup_->notify(); // a new ticker moves the next deadline
+    return added;
 }
 
 void BridgeCore::deactivate_monitor_transfer(ITransferPdu* transfer)
@@ -229,9 +354,54 @@ BridgeHealthDto BridgeCore::get_health() const
     std::lock_guard<std::mutex> lock(state_mtx_);
     health.uptime_usec = (started_time_usec_ > 0 && now >= started_time_usec_) ? (now - started_time_usec_) : 0;
     health.last_error = last_error_;
+    health.cycle = timing_.stats();
     return health;
 }
 
+namespace {
+// Optional counters of the connection's batching, budget and async stages.
+void fill_connection_stats(const BridgeConnection& connection, ConnectionStateDto& dto)
+{
+    if (connection.has_batches()) {
+        dto.batch_frames = connection.batch_frames_sent();
+        dto.batched_pdus = connection.batch_records_sent();
+    }
+    if (connection.has_budgets()) {
+        const BudgetStats stats = connection.budget_stats();
+        dto.budget_bytes_per_sec = stats.bytes_per_sec;
+        dto.budget_sent_bytes = stats.sent_bytes;
+        dto.budget_utilization = stats.allowance_bytes
+            ? static_cast<double>(stats.sent_bytes) / static_cast<double>(stats.allowance_bytes) : 0.0;
+        dto.budget_deferred = stats.deferred;
+        dto.budget_dropped = stats.dropped;
+    }
+    if (connection.has_async_senders()) {
+        const AsyncSenderStats stats = connection.async_sender_stats();
+        dto.async_queue_depth = stats.depth;
+        dto.async_queue_max_depth = stats.max_depth;
+        dto.async_sent = stats.sent;
+        dto.async_dropped = stats.dropped;
+        dto.async_latency_avg_usec = stats.sent ? stats.latency_total_ns / stats.sent / 1000 : 0;
+        dto.async_latency_max_usec = stats.latency_max_ns / 1000;
+    }
+    if (connection.has_presence()) {
+        const PresenceStats stats = connection.presence_stats();
+        dto.late_joins = stats.joins;
+        dto.late_join_replays = stats.replays;
+    }
+    for (const auto& [endpoint_id, stats] : connection.backpressure_stats()) {
+        DestinationStateDto destination;
+        destination.endpoint_id = endpoint_id;
+        destination.congested = stats.congested;
+        destination.congestion_events = stats.congestion_events;
+        destination.recoveries = stats.recoveries;
+        destination.coalesced_drops = stats.coalesced_drops;
+        destination.flushed = stats.flushed;
+        dto.destinations.push_back(std::move(destination));
+    }
+}
+} // namespace
+
 std::vector<ConnectionStateDto> BridgeCore::list_connections() const
 {
     std::vector<ConnectionStateDto> out;
@@ -243,6 +413,7 @@ std::vector<ConnectionStateDto> BridgeCore::list_connections() const
         dto.active = connection->is_active();
         dto.epoch = connection->get_epoch();
         dto.epoch_validation = connection->epoch_validation_enabled();
+        fill_connection_stats(*connection, dto);
         out.push_back(std::move(dto));
     }
     std::sort(out.begin(), out.end(), [](const ConnectionStateDto& a, const ConnectionStateDto& b) {
@@ -264,7 +435,10 @@ std::optional<std::vector<PduStateDto>> BridgeCore::list_pdus(const std::string&
     std::vector<PduStateDto> out;
     out.reserve(allowed->size());
     auto src_endpoint = connection->get_source_endpoint();
-    for (const auto& [robot, pdu_name] : *allowed) {
+    auto snapshot = find_source_snapshot_(src_endpoint);
+    for (const auto& key : *allowed) {
+        const std::string& robot = keys_->name(key.robot);
+        const std::string& pdu_name = keys_->name(key.pdu);
         PduStateDto dto;
         dto.connection_id = connection_id;
         dto.robot = robot;
@@ -273,8 +447,24 @@ std::optional<std::vector<PduStateDto>> BridgeCore::list_pdus(const std::string&
             const int ch = src_endpoint->get_pdu_channel_id({robot, pdu_name});
             if (ch >= 0) {
                 dto.channel_id = ch;
+                dto.pdu_size = src_endpoint->get_pdu_size({robot, pdu_name});
+                const auto slot = snapshot ? snapshot->find_slot({robot, ch}) : SourceSnapshot::kInvalidSlot;
+                if (slot != SourceSnapshot::kInvalidSlot) {
+                    dto.max_received_size = snapshot->high_water_mark(slot);
+                }
             }
         }
+        const TransferCounters counters = connection->transfer_counters(key);
+        dto.transfers = counters.transfers;
+        dto.missed_ticks = counters.missed_ticks;
+        dto.unchanged_skips = counters.unchanged_skips;
+        dto.dedupe_suppressed = counters.dedupe_suppressed;
+        dto.trailing_sends = counters.trailing_sends;
+        dto.compressed_in_bytes = counters.compressed_in_bytes;
+        dto.compressed_out_bytes = counters.compressed_out_bytes;
+        dto.compress_errors = counters.compress_errors;
+        dto.compress_usec = counters.compress_ns / 1000;
+        dto.decompress_usec = counters.decompress_ns / 1000;
         out.push_back(std::move(dto));
     }
     return out;
@@ -282,18 +472,18 @@ std::optional<std::vector<PduStateDto>> BridgeCore::list_pdus(const std::string&
 
 std::optional<ConnectionStateDto> BridgeCore::get_connection(const std::string& connection_id) const
 {
-    for (const auto& connection : connections_) {
-        if (connection->getConnectionId() == connection_id) {
-            ConnectionStateDto dto;
-            dto.connection_id = connection->getConnectionId();
-            dto.node_id = connection->getNodeId();
-            dto.active = connection->is_active();
-            dto.epoch = connection->get_epoch();
-            dto.epoch_validation = connection->epoch_validation_enabled();
-            return dto;
-        }
+    const auto* connection = find_connection_(connection_id);
+    if (!connection) {
+        return std::nullopt;
     }
-    return std::nullopt;
+    ConnectionStateDto dto;
+    dto.connection_id = connection->getConnectionId();
+    dto.node_id = connection->getNodeId();
+    dto.active = connection->is_active();
+    dto.epoch = connection->get_epoch();
+    dto.epoch_validation = connection->epoch_validation_enabled();
+    fill_connection_stats(*connection, dto);
+    return dto;
 }
 
 bool BridgeCore::has_connection_(const std::string& connection_id) const
@@ -303,22 +493,16 @@ bool BridgeCore::has_connection_(const std::string& connection_id) const
 
 const BridgeConnection* BridgeCore::find_connection_(const std::string& connection_id) const
 {
-    for (const auto& connection : connections_) {
-        if (connection->getConnectionId() == connection_id) {
-            return connection.get();
-        }
+    const auto it = connection_index_.find(keys_->find(connection_id));
+    if (it == connection_index_.end()) {
+        return nullptr;
     }
-    return nullptr;
+    return connections_[it->second].get();
 }
 
 BridgeConnection* BridgeCore::find_connection_mutable_(const std::string& connection_id)
 {
-    for (auto& connection : connections_) {
-        if (connection->getConnectionId() == connection_id) {
-            return connection.get();
-        }
-    }
-    return nullptr;
+    return const_cast<BridgeConnection*>(find_connection_(connection_id));
 }
 
 bool BridgeCore::is_supported_monitor_policy_(const MonitorPolicy& policy) const
@@ -385,7 +569,9 @@ std::optional<ResolvedMonitorSelection> BridgeCore::resolve_monitor_keys_(
     }
     out.keys.reserve(allowed->size());
     out.filters.reserve(allowed->size());
-    for (const auto& [robot, pdu_name] : *allowed) {
+    for (const auto& key : *allowed) {
+        const std::string& robot = keys_->name(key.robot);
+        const std::string& pdu_name = keys_->name(key.pdu);
         out.keys.push_back({
             .id = robot + "." + pdu_name + ".monitor",
             .robot_name = robot,
@@ -403,10 +589,9 @@ std::optional<ResolvedMonitorSelection> BridgeCore::resolve_monitor_keys_(
     return out;
 }
 
-const std::vector<std::pair<std::string, std::string>>* BridgeCore::find_transferable_pdus_(
-    const std::string& connection_id) const
+const std::vector<PduKeyId>* BridgeCore::find_transferable_pdus_(const std::string& connection_id) const
 {
-    const auto it = connection_transferable_pdus_.find(connection_id);
+    const auto it = connection_transferable_pdus_.find(keys_->find(connection_id));
     if (it == connection_transferable_pdus_.end()) {
         return nullptr;
     }
@@ -0,0 +1,91 @@
+#include "hakoniwa/pdu/bridge/cycle_timing.hpp"
+#include <algorithm>
+#include <bit>
+#include <thread>
+
+namespace hakoniwa::pdu::bridge {
+
+namespace {
+
+uint64_t to_usec(CycleTiming::Clock::duration d)
+{
+    const auto usec = std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+    return usec > 0 ? static_cast<uint64_t>(usec) : 0;
+}
+
+} // namespace
+
+size_t CycleTiming::bucket_(uint64_t cycle_usec)
+{
+    const auto width = static_cast<size_t>(std::bit_width(cycle_usec / kCycleHistogramBaseUsec));
+    return std::min(width, kCycleHistogramBuckets - 1);
+}
+
+void CycleTiming::begin(Clock::time_point start)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    start_ = start;
+    started_ = true;
+    if (paced_) {
+        max_jitter_usec_ = std::max(max_jitter_usec_, start > boundary_ ? to_usec(start - boundary_) : 0);
+        paced_ = false;
+    }
+}
+
+void CycleTiming::end(Clock::time_point finish)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (!started_) {
+        return;
+    }
+    started_ = false;
+    const uint64_t cycle_usec = to_usec(finish - start_);
+    ++cycles_;
+    total_usec_ += cycle_usec;
+    max_cycle_usec_ = std::max(max_cycle_usec_, cycle_usec);
+    ++histogram_[bucket_(cycle_usec)];
+    if (period_usec_ > 0 && cycle_usec > period_usec_) {
+        ++overruns_;
+    }
+}
+
+void CycleTiming::sleep_until_next_period()
+{
+    if (period_usec_ == 0) {
+        return;
+    }
+    Clock::time_point wake;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        const auto now = Clock::now();
+        const auto period = std::chrono::microseconds(period_usec_);
+        // The first paced cycle starts its schedule at its own start.
+        Clock::time_point base = boundary_ == Clock::time_point{} ? start_ : boundary_;
+        if (base == Clock::time_point{}) {
+            base = now;
+        }
+        wake = base + period;
+        if (wake < now) {
+            wake = now; // behind: restart the schedule instead of catching up
+        }
+        boundary_ = wake;
+        paced_ = true;
+    }
+    std::this_thread::sleep_until(wake);
+}
+
+CycleTimingDto CycleTiming::stats() const
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    CycleTimingDto dto;
+    dto.period_usec = period_usec_;
+    dto.cycles = cycles_;
+    dto.overruns = overruns_;
+    dto.mean_cycle_usec = cycles_ ? total_usec_ / cycles_ : 0;
+    dto.max_cycle_usec = max_cycle_usec_;
+    dto.max_jitter_usec = max_jitter_usec_;
+    dto.histogram.assign(histogram_.begin(), histogram_.end());
+    return dto;
+}
+
+} // namespace hakoniwa::pdu::bridge
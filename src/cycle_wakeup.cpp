@@ -0,0 +1,32 @@
+#include "hakoniwa/pdu/bridge/cycle_wakeup.hpp"
+#include "hakoniwa/pdu/bridge/cycle_clock.hpp"
+#include <chrono>
+
+namespace hakoniwa::pdu::bridge {
+
+void CycleWakeup::notify()
+{
+    notifications_.fetch_add(1, std::memory_order_relaxed);
+    if (pending_.exchange(true, std::memory_order_acq_rel)) {
+        return; // the waiter has not consumed the previous one yet
+    }
+    {
+        // Orders the flag with a waiter between its check and its sleep.
+        std::lock_guard<std::mutex> lock(mtx_);
+    }
+    cv_.notify_one();
+}
+
+bool CycleWakeup::wait_for_usec(uint64_t timeout_usec)
+{
+    std::unique_lock<std::mutex> lock(mtx_);
+    auto notified = [this] { return pending_.load(std::memory_order_acquire); };
+    if (timeout_usec == kNoDeadline) {
+        cv_.wait(lock, notified);
+    } else if (timeout_usec > 0) {
+        cv_.wait_for(lock, std::chrono::microseconds(timeout_usec), notified);
+    }
+    return pending_.exchange(false, std::memory_order_acq_rel);
+}
+
+} // namespace hakoniwa::pdu::bridge
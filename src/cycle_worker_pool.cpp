@@ -0,0 +1,149 @@
+#include "hakoniwa/pdu/bridge/cycle_worker_pool.hpp"
+#include <algorithm>
+#include <iostream>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace hakoniwa::pdu::bridge {
+
+namespace {
+
+void pin_current_thread(int cpu)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    const int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (rc != 0) {
+        std::cerr << "WARNING: CycleWorkerPool: cannot pin worker to CPU " << cpu << " (error " << rc << ")" << std::endl;
+    }
+#else
+    std::cerr << "WARNING: CycleWorkerPool: CPU affinity is not supported on this platform (CPU " << cpu << ")" << std::endl;
+#endif
+}
+
+} // namespace
+
+CycleWorkerPool::CycleWorkerPool(WorkerPoolSettings settings)
+    : settings_(std::move(settings)),
+      ranges_(std::max<size_t>(settings_.threads, 1))
+{
+    workers_.reserve(ranges_.size() - 1);
+    for (size_t self = 1; self < ranges_.size(); ++self) {
+        workers_.emplace_back([this, self] { worker_main_(self); });
+    }
+}
+
+CycleWorkerPool::~CycleWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        stopping_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void CycleWorkerPool::run(size_t task_count, const std::function<void(size_t)>& task)
+{
+    runs_.fetch_add(1, std::memory_order_relaxed);
+    if (task_count == 0) {
+        return;
+    }
+    const size_t n = ranges_.size();
+    if (n == 1 || task_count == 1) {
+        for (size_t i = 0; i < task_count; ++i) {
+            task(i);
+        }
+        tasks_.fetch_add(task_count, std::memory_order_relaxed);
+        return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        ranges_[i].next.store(task_count * i / n, std::memory_order_relaxed);
+        ranges_[i].end = task_count * (i + 1) / n;
+    }
+    {
+        // The lock publishes the ranges to the workers.
+        std::lock_guard<std::mutex> lock(mtx_);
+        task_ = &task;
+        busy_workers_ = workers_.size();
+        ++generation_;
+    }
+    start_cv_.notify_all();
+    work_(0);
+    std::unique_lock<std::mutex> lock(mtx_);
+    done_cv_.wait(lock, [this] { return busy_workers_ == 0; });
+    task_ = nullptr;
+}
+
+void CycleWorkerPool::worker_main_(size_t self)
+{
+    if (!settings_.cpu_affinity.empty()) {
+        pin_current_thread(settings_.cpu_affinity[self % settings_.cpu_affinity.size()]);
+    }
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mtx_);
+            start_cv_.wait(lock, [this, seen] { return stopping_ || generation_ != seen; });
+            if (stopping_) {
+                return;
+            }
+            seen = generation_;
+        }
+        work_(self);
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            last = --busy_workers_ == 0;
+        }
+        if (last) {
+            done_cv_.notify_one();
+        }
+    }
+}
+
+void CycleWorkerPool::work_(size_t self)
+{
+    const auto& task = *task_;
+    const size_t n = ranges_.size();
+    uint64_t done = 0;
+    uint64_t stolen = 0;
+    for (size_t k = 0; k < n; ++k) {
+        Range& range = ranges_[(self + k) % n];
+        for (;;) {
+            const size_t i = range.next.fetch_add(1, std::memory_order_relaxed);
+            if (i >= range.end) {
+                break;
+            }
+            task(i);
+            ++done;
+            if (k != 0) {
+                ++stolen;
+            }
+        }
+    }
+    tasks_.fetch_add(done, std::memory_order_relaxed);
+    if (stolen) {
+        steals_.fetch_add(stolen, std::memory_order_relaxed);
+    }
+}
+
+WorkerPoolStats CycleWorkerPool::stats() const
+{
+    WorkerPoolStats s;
+    s.threads = ranges_.size();
+    s.runs = runs_.load(std::memory_order_relaxed);
+    s.tasks = tasks_.load(std::memory_order_relaxed);
+    s.steals = steals_.load(std::memory_order_relaxed);
+    return s;
+}
+
+} // namespace hakoniwa::pdu::bridge
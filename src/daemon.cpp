@@ -69,7 +69,8 @@ int main(int argc, char* argv[]) {
 
     if (argc < 4) {
         std::cerr << "Usage: " << argv[0] << " <path_to_bridge.json> <delta_time_step_usec> <path_to_endpoint_container.json> [node_name] "
-                  << "[--enable-ondemand --ondemand-mux-config <path_to_endpoint_mux.json>]"
+                  << "[--enable-ondemand --ondemand-mux-config <path_to_endpoint_mux.json>] "
+                  << "[--event-loop [--max-idle-ms <ms>]]"
                   << " (on-demand subscribe default policy: throttle interval_ms=100; filters: omitted/empty only)"
                   << std::endl;
         return 1;
@@ -87,6 +88,8 @@ int main(int argc, char* argv[]) {
     std::string node_name = "node1";
     bool enable_ondemand = false;
     std::string ondemand_mux_config_path;
+    bool event_loop = false;
+    uint64_t max_idle_ms = 100;
 
     for (int i = 4; i < argc; ++i) {
         const std::string arg = argv[i];
@@ -102,6 +105,23 @@ int main(int argc, char* argv[]) {
             ondemand_mux_config_path = argv[++i];
             continue;
         }
+        if (arg == "--event-loop") {
+            event_loop = true;
+            continue;
+        }
+        if (arg == "--max-idle-ms") {
+            if ((i + 1) >= argc) {
+                std::cerr << "--max-idle-ms requires a value" << std::endl;
+                return 1;
+            }
+            const char* value = argv[++i];
+            auto parse = std::from_chars(value, value + std::strlen(value), max_idle_ms);
+            if (parse.ec != std::errc() || max_idle_ms == 0) {
+                std::cerr << "Invalid --max-idle-ms: " << value << std::endl;
+                return 1;
+            }
+            continue;
+        }
         if (!arg.empty() && arg[0] != '-' && node_name == "node1") {
             node_name = arg;
             continue;
@@ -157,7 +177,14 @@ int main(int argc, char* argv[]) {
             g_core->stop();
             continue;
         }
-        time_source->sleep_delta_time();
+        if (event_loop) {
+            // Sleep until a transfer or poll is due or an event arrives. The
+            // cap bounds the delay of SIGINT and of new on-demand sessions,
+            // which are only picked up by a cycle.
+            (void)g_core->wait_next_cycle(max_idle_ms * 1000);
+        } else {
+            g_core->sleep_until_next_period();
+        }
     }
     g_core->detach_monitor_runtime();
     std::cout << "Bridge core stopped." << std::endl;
@@ -0,0 +1,59 @@
+#include "hakoniwa/pdu/bridge/destination_backpressure.hpp"
+#include <iostream>
+
+namespace hakoniwa::pdu::bridge {
+
+bool DestinationBackpressure::admit(uint64_t now_usec)
+{
+    if (!congested_.load(std::memory_order_acquire)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (!congested_.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    if (now_usec < next_probe_usec_) {
+        return false;
+    }
+    next_probe_usec_ = now_usec + settings_.probe_interval_usec;
+    return true;
+}
+
+void DestinationBackpressure::on_send(uint64_t now_usec, bool ok, uint64_t send_usec)
+{
+    const bool healthy = ok && (settings_.slow_send_usec == 0 || send_usec <= settings_.slow_send_usec);
+    if (healthy && !congested_.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mtx_);
+    const bool was_congested = congested_.load(std::memory_order_relaxed);
+    if (healthy == !was_congested) {
+        return;
+    }
+    if (healthy) {
+        ++recoveries_;
+        congested_.store(false, std::memory_order_release);
+        recovered_.store(true, std::memory_order_release);
+        std::cerr << "INFO: Destination " << endpoint_id_ << " recovered" << std::endl;
+        return;
+    }
+    ++congestion_events_;
+    next_probe_usec_ = now_usec + settings_.probe_interval_usec;
+    congested_.store(true, std::memory_order_release);
+    std::cerr << "WARNING: Destination " << endpoint_id_ << " congested ("
+              << (ok ? "slow send" : "send failed") << "); coalescing to latest values" << std::endl;
+}
+
+BackpressureStats DestinationBackpressure::stats() const
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    BackpressureStats out;
+    out.congested = congested_.load(std::memory_order_relaxed);
+    out.congestion_events = congestion_events_;
+    out.recoveries = recoveries_;
+    out.coalesced_drops = coalesced_drops_.load(std::memory_order_relaxed);
+    out.flushed = flushed_.load(std::memory_order_relaxed);
+    return out;
+}
+
+} // namespace hakoniwa::pdu::bridge
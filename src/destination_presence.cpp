@@ -0,0 +1,33 @@
+#include "hakoniwa/pdu/bridge/destination_presence.hpp"
+
+namespace hakoniwa::pdu::bridge {
+
+bool DestinationPresence::poll()
+{
+    if (!endpoint_) {
+        return false;
+    }
+    bool running = false;
+    if (endpoint_->is_running(running) != HAKO_PDU_ERR_OK) {
+        // Same reading as the send path: an endpoint that cannot tell is up.
+        running = true;
+    }
+    const bool was_running = running_.exchange(running, std::memory_order_acq_rel);
+    const bool joined = polled_ && running && !was_running;
+    polled_ = true;
+    if (joined) {
+        joins_.fetch_add(1, std::memory_order_acq_rel);
+    }
+    return joined;
+}
+
+PresenceStats DestinationPresence::stats() const
+{
+    PresenceStats out;
+    out.running = running_.load(std::memory_order_acquire);
+    out.joins = joins_.load(std::memory_order_acquire);
+    out.replays = replays_.load(std::memory_order_relaxed);
+    return out;
+}
+
+} // namespace hakoniwa::pdu::bridge
@@ -0,0 +1,205 @@
+#include "hakoniwa/pdu/bridge/endpoint_poller.hpp"
+#include <algorithm>
+
+namespace hakoniwa::pdu::bridge {
+
+std::optional<EndpointPolling> parse_endpoint_polling(const std::string& name)
+{
+    if (name == "auto") {
+        return EndpointPolling::Auto;
+    }
+    if (name == "always") {
+        return EndpointPolling::Always;
+    }
+    if (name == "never") {
+        return EndpointPolling::Never;
+    }
+    return std::nullopt;
+}
+
+const char* to_string(EndpointPolling mode)
+{
+    switch (mode) {
+    case EndpointPolling::Always:
+        return "always";
+    case EndpointPolling::Never:
+        return "never";
+    case EndpointPolling::Auto:
+    default:
+        return "auto";
+    }
+}
+
+void EndpointPoller::add_endpoint(const std::string& endpoint_id, std::shared_ptr<hakoniwa::pdu::Endpoint> endpoint)
+{
+    if (!endpoint) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (find_(endpoint)) {
+        return;
+    }
+    auto entry = std::make_unique<Entry>();
+    entry->id = endpoint_id;
+    entry->endpoint = std::move(endpoint);
+    entries_.push_back(std::move(entry));
+}
+
+void EndpointPoller::attach_snapshot(const std::shared_ptr<SourceSnapshot>& snapshot)
+{
+    if (!snapshot || !snapshot->endpoint()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mtx_);
+    Entry* entry = find_(snapshot->endpoint());
+    if (!entry) {
+        auto created = std::make_unique<Entry>();
+        created->id = snapshot->endpoint()->get_name();
+        created->endpoint = snapshot->endpoint();
+        entry = created.get();
+        entries_.push_back(std::move(created));
+    }
+    entry->snapshot = snapshot;
+}
+
+bool EndpointPoller::set_mode(const std::string& endpoint_id, EndpointPolling mode)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    for (auto& entry : entries_) {
+        if (entry->id == endpoint_id) {
+            entry->mode = mode;
+            entry->interval_usec = 0;
+            entry->next_poll_usec = 0;
+            entry->started = false;
+            return true;
+        }
+    }
+    return false;
+}
+
+void EndpointPoller::set_settings(const PollingSettings& settings)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    settings_ = settings;
+}
+
+void EndpointPoller::set_event_loop(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    event_loop_ = enabled;
+}
+
+bool EndpointPoller::polled_(const Entry& entry)
+{
+    switch (entry.mode) {
+    case EndpointPolling::Always:
+        return true;
+    case EndpointPolling::Never:
+        return false;
+    case EndpointPolling::Auto:
+    default:
+        // A snapshot subscribes only once a key is registered with it.
+        return entry.snapshot && entry.snapshot->has_keys();
+    }
+}
+
+EndpointPoller::Entry* EndpointPoller::find_(const std::shared_ptr<hakoniwa::pdu::Endpoint>& endpoint)
+{
+    for (auto& entry : entries_) {
+        if (entry->endpoint == endpoint) {
+            return entry.get();
+        }
+    }
+    return nullptr;
+}
+
+void EndpointPoller::poll(const CycleContext& ctx)
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        due_.clear();
+        for (auto& entry : entries_) {
+            if (!polled_(*entry)) {
+                continue;
+            }
+            if (ctx.now_usec < entry->next_poll_usec) {
+                ++entry->idle_skips;
+                continue;
+            }
+            due_.emplace_back(entry.get(), entry->snapshot ? entry->snapshot->event_count() : 0);
+        }
+    }
+    // Receive callbacks run from here; they must not wait on this poller.
+    for (const auto& [entry, _] : due_) {
+        entry->endpoint->process_recv_events();
+    }
+    std::lock_guard<std::mutex> lock(mtx_);
+    for (const auto& [entry, events_before] : due_) {
+        const bool active = entry->snapshot && entry->snapshot->event_count() != events_before;
+        after_poll_(*entry, ctx.now_usec, active);
+    }
+}
+
+void EndpointPoller::after_poll_(Entry& entry, uint64_t now_usec, bool active)
+{
+    ++entry.polls;
+    if (!entry.started || active) {
+        entry.started = true;
+        entry.last_activity_usec = now_usec;
+    }
+    uint64_t idle_after = settings_.idle_after_usec;
+    uint64_t max_interval = settings_.max_interval_usec;
+    if (idle_after == 0 && event_loop_) {
+        idle_after = kEventLoopIdleAfterUsec;
+        if (max_interval == 0) {
+            max_interval = kEventLoopMaxPollIntervalUsec;
+        }
+    }
+    const bool back_off = entry.mode == EndpointPolling::Auto
+        && idle_after > 0
+        && now_usec >= entry.last_activity_usec
+        && now_usec - entry.last_activity_usec >= idle_after;
+    if (!back_off) {
+        entry.interval_usec = 0;
+        entry.next_poll_usec = 0;
+        return;
+    }
+    if (max_interval == 0) {
+        max_interval = kDefaultMaxPollIntervalUsec;
+    }
+    const uint64_t first = std::clamp<uint64_t>(settings_.min_interval_usec, 1, max_interval);
+    entry.interval_usec = entry.interval_usec == 0 ? first : std::min(entry.interval_usec * 2, max_interval);
+    entry.next_poll_usec = now_usec + entry.interval_usec;
+}
+
+uint64_t EndpointPoller::next_deadline_usec() const
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    uint64_t deadline = kNoDeadline;
+    for (const auto& entry : entries_) {
+        if (polled_(*entry)) {
+            deadline = std::min(deadline, entry->next_poll_usec);
+        }
+    }
+    return deadline;
+}
+
+std::vector<EndpointPollStats> EndpointPoller::stats() const
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    std::vector<EndpointPollStats> out;
+    out.reserve(entries_.size());
+    for (const auto& entry : entries_) {
+        EndpointPollStats s;
+        s.endpoint_id = entry->id;
+        s.mode = entry->mode;
+        s.polled = polled_(*entry);
+        s.polls = entry->polls;
+        s.idle_skips = entry->idle_skips;
+        s.interval_usec = entry->interval_usec;
+        out.push_back(std::move(s));
+    }
+    return out;
+}
+
+} // namespace hakoniwa::pdu::bridge
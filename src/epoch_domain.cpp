@@ -0,0 +1,96 @@
+#include "hakoniwa/pdu/bridge/epoch_domain.hpp"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <thread>
+
+namespace hakoniwa::pdu::bridge {
+
+EpochDomain::Guard EpochDomain::pin()
+{
+    // Start at a per-thread slot so threads rarely contend for the same one.
+    thread_local const size_t hint = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    for (;;) {
+        const uint64_t epoch = global_epoch_.load(std::memory_order_seq_cst);
+        for (size_t i = 0; i < kReaderSlots; ++i) {
+            auto& slot = slots_[(hint + i) % kReaderSlots].epoch;
+            uint64_t expected = 0;
+            if (slot.compare_exchange_strong(expected, epoch, std::memory_order_seq_cst)) {
+                return Guard(&slot);
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+void EpochDomain::retire(std::shared_ptr<const void> object)
+{
+    if (!object) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(retire_mtx_);
+    // Readers pinned at this epoch or earlier may still hold the object;
+    // later ones pinned after it was unpublished.
+    const uint64_t epoch = global_epoch_.fetch_add(1, std::memory_order_seq_cst);
+    retired_.emplace_back(epoch, std::move(object));
+    retired_count_.store(retired_.size(), std::memory_order_relaxed);
+}
+
+size_t EpochDomain::reclaim()
+{
+    std::vector<std::shared_ptr<const void>> doomed;
+    size_t remaining = 0;
+    {
+        std::lock_guard<std::mutex> lock(retire_mtx_);
+        remaining = reclaim_locked_(doomed);
+    }
+    // Destructors run outside the lock; they may take locks of their own.
+    doomed.clear();
+    return remaining;
+}
+
+void EpochDomain::try_reclaim()
+{
+    if (retired_count_.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    std::vector<std::shared_ptr<const void>> doomed;
+    {
+        std::unique_lock<std::mutex> lock(retire_mtx_, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return;
+        }
+        reclaim_locked_(doomed);
+    }
+    doomed.clear();
+}
+
+size_t EpochDomain::reclaim_locked_(std::vector<std::shared_ptr<const void>>& doomed)
+{
+    if (retired_.empty()) {
+        return 0;
+    }
+    uint64_t oldest_pinned = std::numeric_limits<uint64_t>::max();
+    for (const auto& slot : slots_) {
+        const uint64_t epoch = slot.epoch.load(std::memory_order_seq_cst);
+        if (epoch != 0) {
+            oldest_pinned = std::min(oldest_pinned, epoch);
+        }
+    }
+    auto keep = std::partition(retired_.begin(), retired_.end(),
+        [oldest_pinned](const auto& r) { return r.first >= oldest_pinned; });
+    for (auto it = keep; it != retired_.end(); ++it) {
+        doomed.push_back(std::move(it->second));
+    }
+    retired_.erase(keep, retired_.end());
+    retired_count_.store(retired_.size(), std::memory_order_relaxed);
+    return retired_.size();
+}
+
+size_t EpochDomain::pending() const
+{
+    std::lock_guard<std::mutex> lock(retire_mtx_);
+    return retired_.size();
+}
+
+} // namespace hakoniwa::pdu::bridge
@@ -0,0 +1,83 @@
+#include "hakoniwa/pdu/bridge/key_registry.hpp"
+#include <mutex>
+
+namespace hakoniwa::pdu::bridge {
+
+NameId KeyRegistry::intern(std::string_view name)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(mtx_);
+        auto it = ids_.find(name);
+        if (it != ids_.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(mtx_);
+    auto it = ids_.find(name);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+    const auto id = static_cast<NameId>(names_.size());
+    names_.emplace_back(name);
+    ids_.emplace(names_.back(), id);
+    return id;
+}
+
+NameId KeyRegistry::find(std::string_view name) const
+{
+    std::shared_lock<std::shared_mutex> lock(mtx_);
+    auto it = ids_.find(name);
+    return it == ids_.end() ? kInvalidNameId : it->second;
+}
+
+const std::string& KeyRegistry::name(NameId id) const
+{
+    static const std::string empty;
+    std::shared_lock<std::shared_mutex> lock(mtx_);
+    return id < names_.size() ? names_[id] : empty;
+}
+
+PduKeyId KeyRegistry::find_pdu(std::string_view robot, std::string_view pdu_name) const
+{
+    std::shared_lock<std::shared_mutex> lock(mtx_);
+    auto robot_it = ids_.find(robot);
+    auto pdu_it = ids_.find(pdu_name);
+    if (robot_it == ids_.end() || pdu_it == ids_.end()) {
+        return {};
+    }
+    return {robot_it->second, pdu_it->second};
+}
+
+std::string KeyRegistry::label(const PduKeyId& key) const
+{
+    return name(key.robot) + "." + name(key.pdu);
+}
+
+const hakoniwa::pdu::PduResolvedKey& KeyRegistry::resolved_key(NameId robot, int channel_id)
+{
+    const uint64_t key = code(robot, channel_id);
+    {
+        std::shared_lock<std::shared_mutex> lock(mtx_);
+        auto it = resolved_index_.find(key);
+        if (it != resolved_index_.end()) {
+            return *it->second;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(mtx_);
+    auto it = resolved_index_.find(key);
+    if (it != resolved_index_.end()) {
+        return *it->second;
+    }
+    static const std::string empty;
+    resolved_.push_back({.robot = robot < names_.size() ? names_[robot] : empty, .channel_id = channel_id});
+    resolved_index_.emplace(key, &resolved_.back());
+    return resolved_.back();
+}
+
+size_t KeyRegistry::size() const
+{
+    std::shared_lock<std::shared_mutex> lock(mtx_);
+    return names_.size();
+}
+
+} // namespace hakoniwa::pdu::bridge
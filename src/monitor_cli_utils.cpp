@@ -36,6 +36,24 @@ std::optional<HealthView> parse_health(const nlohmann::json& res)
     out.running = h.value("running", false);
     out.uptime_usec = h.value("uptime_usec", 0);
     out.last_error = h.value("last_error", std::string());
+    if (h.contains("cycle") && h["cycle"].is_object()) {
+        const auto& c = h["cycle"];
+        out.period_usec = c.value("period_usec", static_cast<int64_t>(-1));
+        out.cycles = c.value("cycles", static_cast<int64_t>(-1));
+        out.overruns = c.value("overruns", static_cast<int64_t>(-1));
+        out.mean_cycle_usec = c.value("mean_cycle_usec", static_cast<int64_t>(-1));
+        out.max_cycle_usec = c.value("max_cycle_usec", static_cast<int64_t>(-1));
+        out.max_jitter_usec = c.value("max_jitter_usec", static_cast<int64_t>(-1));
+        if (c.contains("histogram") && c["histogram"].is_array()) {
+            for (const auto& b : c["histogram"]) {
+                CycleBucketView bucket;
+                bucket.lt_usec = b.value("lt_usec", static_cast<int64_t>(-1));
+                bucket.ge_usec = b.value("ge_usec", static_cast<int64_t>(-1));
+                bucket.count = b.value("count", static_cast<int64_t>(0));
+                out.cycle_histogram.push_back(bucket);
+            }
+        }
+    }
     return out;
 }
 
@@ -53,6 +71,33 @@ std::optional<std::vector<ConnectionView>> parse_connections(const nlohmann::jso
         item.active = c.value("active", false);
         item.epoch = c.value("epoch", -1);
         item.epoch_validation = c.value("epoch_validation", false);
+        item.batch_frames = c.value("batch_frames", static_cast<int64_t>(-1));
+        item.batched_pdus = c.value("batched_pdus", static_cast<int64_t>(-1));
+        item.budget_bytes_per_sec = c.value("budget_bytes_per_sec", static_cast<int64_t>(-1));
+        item.budget_sent_bytes = c.value("budget_sent_bytes", static_cast<int64_t>(-1));
+        item.budget_utilization = c.value("budget_utilization", -1.0);
+        item.budget_deferred = c.value("budget_deferred", static_cast<int64_t>(-1));
+        item.budget_dropped = c.value("budget_dropped", static_cast<int64_t>(-1));
+        item.async_queue_depth = c.value("async_queue_depth", static_cast<int64_t>(-1));
+        item.async_queue_max_depth = c.value("async_queue_max_depth", static_cast<int64_t>(-1));
+        item.async_sent = c.value("async_sent", static_cast<int64_t>(-1));
+        item.async_dropped = c.value("async_dropped", static_cast<int64_t>(-1));
+        item.async_latency_avg_usec = c.value("async_latency_avg_usec", static_cast<int64_t>(-1));
+        item.async_latency_max_usec = c.value("async_latency_max_usec", static_cast<int64_t>(-1));
+        item.late_joins = c.value("late_joins", static_cast<int64_t>(-1));
+        item.late_join_replays = c.value("late_join_replays", static_cast<int64_t>(-1));
+        if (c.contains("destinations") && c["destinations"].is_array()) {
+            for (const auto& d : c["destinations"]) {
+                DestinationView destination;
+                destination.endpoint_id = d.value("endpoint_id", std::string());
+                destination.congested = d.value("congested", false);
+                destination.congestion_events = d.value("congestion_events", static_cast<int64_t>(0));
+                destination.recoveries = d.value("recoveries", static_cast<int64_t>(0));
+                destination.coalesced_drops = d.value("coalesced_drops", static_cast<int64_t>(0));
+                destination.flushed = d.value("flushed", static_cast<int64_t>(0));
+                item.destinations.push_back(std::move(destination));
+            }
+        }
         out.push_back(std::move(item));
     }
     return out;
@@ -94,6 +139,17 @@ std::optional<std::vector<PduView>> parse_pdus(const nlohmann::json& res)
         item.robot = p.value("robot", std::string());
         item.pdu_name = p.value("pdu_name", std::string());
         item.channel_id = p.value("channel_id", -1);
+        item.pdu_size = p.value("pdu_size", static_cast<int64_t>(-1));
+        item.max_received_size = p.value("max_received_size", static_cast<int64_t>(-1));
+        item.transfers = p.value("transfers", static_cast<int64_t>(-1));
+        item.missed_ticks = p.value("missed_ticks", static_cast<int64_t>(-1));
+        item.unchanged_skips = p.value("unchanged_skips", static_cast<int64_t>(-1));
+        item.dedupe_suppressed = p.value("dedupe_suppressed", static_cast<int64_t>(-1));
+        item.trailing_sends = p.value("trailing_sends", static_cast<int64_t>(-1));
+        item.compressed_in_bytes = p.value("compressed_in_bytes", static_cast<int64_t>(-1));
+        item.compressed_out_bytes = p.value("compressed_out_bytes", static_cast<int64_t>(-1));
+        item.compress_usec = p.value("compress_usec", static_cast<int64_t>(-1));
+        item.decompress_usec = p.value("decompress_usec", static_cast<int64_t>(-1));
         out.push_back(std::move(item));
     }
     return out;
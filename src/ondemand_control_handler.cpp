@@ -62,10 +62,32 @@ nlohmann::json OnDemandControlHandler::handle_request(
 
     if (type == "health") {
         const auto health = runtime_->get_health();
+        nlohmann::json histogram = nlohmann::json::array();
+        for (size_t i = 0; i < health.cycle.histogram.size(); ++i) {
+            if (health.cycle.histogram[i] == 0) {
+                continue;
+            }
+            nlohmann::json bucket{{"count", health.cycle.histogram[i]}};
+            if (i + 1 < kCycleHistogramBuckets) {
+                bucket["lt_usec"] = kCycleHistogramBaseUsec << i;
+            } else {
+                bucket["ge_usec"] = kCycleHistogramBaseUsec << (i - 1);
+            }
+            histogram.push_back(std::move(bucket));
+        }
         nlohmann::json body{
             {"running", health.running},
             {"uptime_usec", health.uptime_usec},
-            {"last_error", health.last_error}
+            {"last_error", health.last_error},
+            {"cycle", {
+                {"period_usec", health.cycle.period_usec},
+                {"cycles", health.cycle.cycles},
+                {"overruns", health.cycle.overruns},
+                {"mean_cycle_usec", health.cycle.mean_cycle_usec},
+                {"max_cycle_usec", health.cycle.max_cycle_usec},
+                {"max_jitter_usec", health.cycle.max_jitter_usec},
+                {"histogram", std::move(histogram)}
+            }}
         };
         nlohmann::json res{
             {"type", "health"},
@@ -118,13 +140,53 @@ nlohmann::json OnDemandControlHandler::handle_request(
         const auto connections_info = runtime_->list_connections();
         nlohmann::json connections = nlohmann::json::array();
         for (const auto& conn : connections_info) {
-            connections.push_back({
+            nlohmann::json one{
                 {"connection_id", conn.connection_id},
                 {"node_id", conn.node_id},
                 {"active", conn.active},
                 {"epoch", static_cast<int>(conn.epoch)},
                 {"epoch_validation", conn.epoch_validation}
-            });
+            };
+            if (conn.batch_frames.has_value()) {
+                one["batch_frames"] = *conn.batch_frames;
+            }
+            if (conn.batched_pdus.has_value()) {
+                one["batched_pdus"] = *conn.batched_pdus;
+            }
+            if (conn.budget_bytes_per_sec.has_value()) {
+                one["budget_bytes_per_sec"] = *conn.budget_bytes_per_sec;
+                one["budget_sent_bytes"] = conn.budget_sent_bytes.value_or(0);
+                one["budget_utilization"] = conn.budget_utilization.value_or(0.0);
+                one["budget_deferred"] = conn.budget_deferred.value_or(0);
+                one["budget_dropped"] = conn.budget_dropped.value_or(0);
+            }
+            if (conn.async_sent.has_value()) {
+                one["async_queue_depth"] = conn.async_queue_depth.value_or(0);
+                one["async_queue_max_depth"] = conn.async_queue_max_depth.value_or(0);
+                one["async_sent"] = *conn.async_sent;
+                one["async_dropped"] = conn.async_dropped.value_or(0);
+                one["async_latency_avg_usec"] = conn.async_latency_avg_usec.value_or(0);
+                one["async_latency_max_usec"] = conn.async_latency_max_usec.value_or(0);
+            }
+            if (conn.late_joins.has_value()) {
+                one["late_joins"] = *conn.late_joins;
+                one["late_join_replays"] = conn.late_join_replays.value_or(0);
+            }
+            if (!conn.destinations.empty()) {
+                nlohmann::json destinations = nlohmann::json::array();
+                for (const auto& dst : conn.destinations) {
+                    destinations.push_back({
+                        {"endpoint_id", dst.endpoint_id},
+                        {"congested", dst.congested},
+                        {"congestion_events", dst.congestion_events},
+                        {"recoveries", dst.recoveries},
+                        {"coalesced_drops", dst.coalesced_drops},
+                        {"flushed", dst.flushed}
+                    });
+                }
+                one["destinations"] = std::move(destinations);
+            }
+            connections.push_back(std::move(one));
         }
         nlohmann::json res{
             {"type", "connections"},
@@ -155,6 +217,42 @@ nlohmann::json OnDemandControlHandler::handle_request(
             if (pdu.channel_id.has_value()) {
                 one["channel_id"] = *pdu.channel_id;
             }
+            if (pdu.pdu_size.has_value()) {
+                one["pdu_size"] = *pdu.pdu_size;
+            }
+            if (pdu.max_received_size.has_value()) {
+                one["max_received_size"] = *pdu.max_received_size;
+            }
+            if (pdu.transfers.has_value()) {
+                one["transfers"] = *pdu.transfers;
+            }
+            if (pdu.missed_ticks.has_value()) {
+                one["missed_ticks"] = *pdu.missed_ticks;
+            }
+            if (pdu.unchanged_skips.has_value()) {
+                one["unchanged_skips"] = *pdu.unchanged_skips;
+            }
+            if (pdu.dedupe_suppressed.has_value()) {
+                one["dedupe_suppressed"] = *pdu.dedupe_suppressed;
+            }
+            if (pdu.trailing_sends.has_value()) {
+                one["trailing_sends"] = *pdu.trailing_sends;
+            }
+            if (pdu.compressed_in_bytes.has_value()) {
+                one["compressed_in_bytes"] = *pdu.compressed_in_bytes;
+            }
+            if (pdu.compressed_out_bytes.has_value()) {
+                one["compressed_out_bytes"] = *pdu.compressed_out_bytes;
+            }
+            if (pdu.compress_errors.has_value()) {
+                one["compress_errors"] = *pdu.compress_errors;
+            }
+            if (pdu.compress_usec.has_value()) {
+                one["compress_usec"] = *pdu.compress_usec;
+            }
+            if (pdu.decompress_usec.has_value()) {
+                one["decompress_usec"] = *pdu.decompress_usec;
+            }
             pdus.push_back(std::move(one));
         }
         nlohmann::json res{
@@ -0,0 +1,199 @@
+#include "hakoniwa/pdu/bridge/payload_compression.hpp"
+#include <cstring>
+#include <memory>
+
+#ifdef HAKO_PDU_BRIDGE_HAVE_LZ4
+#include <lz4.h>
+#include <lz4hc.h>
+#endif
+#ifdef HAKO_PDU_BRIDGE_HAVE_ZSTD
+#include <zstd.h>
+#include <zstd_errors.h>
+#endif
+
+namespace hakoniwa::pdu::bridge {
+
+namespace {
+
+#ifdef HAKO_PDU_BRIDGE_HAVE_ZSTD
+// One context per thread: contexts are not thread-safe, and creating one per
+// call costs more than compressing a typical PDU.
+struct ZstdContexts {
+    std::unique_ptr<ZSTD_CCtx, size_t (*)(ZSTD_CCtx*)> cctx{ZSTD_createCCtx(), ZSTD_freeCCtx};
+    std::unique_ptr<ZSTD_DCtx, size_t (*)(ZSTD_DCtx*)> dctx{ZSTD_createDCtx(), ZSTD_freeDCtx};
+};
+ZstdContexts& zstd_contexts()
+{
+    thread_local ZstdContexts contexts;
+    return contexts;
+}
+#endif
+
+// Compresses src into dst (capacity bytes); returns the compressed size, 0 if
+// it does not fit, or std::nullopt on a codec error or an algorithm missing
+// from this build. The buffers go unused when neither codec is compiled in.
+std::optional<size_t> compress_raw(const CompressionSettings& settings, [[maybe_unused]] std::span<const std::byte> src,
+                    [[maybe_unused]] std::byte* dst, [[maybe_unused]] size_t capacity)
+{
+    switch (settings.algorithm) {
+#ifdef HAKO_PDU_BRIDGE_HAVE_LZ4
+    case CompressionAlgorithm::Lz4: {
+        const char* in = reinterpret_cast<const char*>(src.data());
+        char* out = reinterpret_cast<char*>(dst);
+        const int n = settings.level > 1
+            ? LZ4_compress_HC(in, out, static_cast<int>(src.size()), static_cast<int>(capacity), settings.level)
+            : LZ4_compress_default(in, out, static_cast<int>(src.size()), static_cast<int>(capacity));
+        return n > 0 ? static_cast<size_t>(n) : 0;
+    }
+#endif
+#ifdef HAKO_PDU_BRIDGE_HAVE_ZSTD
+    case CompressionAlgorithm::Zstd: {
+        const size_t n = ZSTD_compressCCtx(zstd_contexts().cctx.get(), dst, capacity, src.data(), src.size(),
+                                           settings.level != 0 ? settings.level : ZSTD_CLEVEL_DEFAULT);
+        if (!ZSTD_isError(n)) {
+            return n;
+        }
+        if (ZSTD_getErrorCode(n) == ZSTD_error_dstSize_tooSmall) {
+            return 0;
+        }
+        return std::nullopt;
+    }
+#endif
+    default:
+        return std::nullopt;
+    }
+}
+
+// Decompresses src into dst (exactly raw_size bytes); false on any mismatch.
+bool decompress_raw(CompressionAlgorithm algorithm, [[maybe_unused]] std::span<const std::byte> src,
+                    [[maybe_unused]] std::byte* dst, [[maybe_unused]] size_t raw_size)
+{
+    switch (algorithm) {
+#ifdef HAKO_PDU_BRIDGE_HAVE_LZ4
+    case CompressionAlgorithm::Lz4: {
+        const int n = LZ4_decompress_safe(reinterpret_cast<const char*>(src.data()), reinterpret_cast<char*>(dst),
+                                          static_cast<int>(src.size()), static_cast<int>(raw_size));
+        return n >= 0 && static_cast<size_t>(n) == raw_size;
+    }
+#endif
+#ifdef HAKO_PDU_BRIDGE_HAVE_ZSTD
+    case CompressionAlgorithm::Zstd: {
+        const size_t n = ZSTD_decompressDCtx(zstd_contexts().dctx.get(), dst, raw_size, src.data(), src.size());
+        return !ZSTD_isError(n) && n == raw_size;
+    }
+#endif
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
+std::optional<CompressionAlgorithm> parse_compression_algorithm(const std::string& name)
+{
+    if (name == "none") {
+        return CompressionAlgorithm::None;
+    }
+    if (name == "lz4") {
+        return CompressionAlgorithm::Lz4;
+    }
+    if (name == "zstd") {
+        return CompressionAlgorithm::Zstd;
+    }
+    return std::nullopt;
+}
+
+const char* compression_algorithm_name(CompressionAlgorithm algorithm)
+{
+    switch (algorithm) {
+    case CompressionAlgorithm::None:
+        return "none";
+    case CompressionAlgorithm::Lz4:
+        return "lz4";
+    case CompressionAlgorithm::Zstd:
+        return "zstd";
+    }
+    return "unknown";
+}
+
+bool compression_available(CompressionAlgorithm algorithm)
+{
+    switch (algorithm) {
+    case CompressionAlgorithm::None:
+        return true;
+    case CompressionAlgorithm::Lz4:
+#ifdef HAKO_PDU_BRIDGE_HAVE_LZ4
+        return true;
+#else
+        return false;
+#endif
+    case CompressionAlgorithm::Zstd:
+#ifdef HAKO_PDU_BRIDGE_HAVE_ZSTD
+        return true;
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+bool is_compressed_frame(std::span<const std::byte> wire)
+{
+    if (wire.size() < sizeof(CompressionHeader)) {
+        return false;
+    }
+    uint32_t magic = 0;
+    std::memcpy(&magic, wire.data(), sizeof(magic));
+    return magic == CompressionHeader::kMagic;
+}
+
+CompressResult compress_payload(const CompressionSettings& settings, std::span<const std::byte> data,
+                                PduBytes& scratch, std::span<const std::byte>& out)
+{
+    out = data;
+    if (settings.algorithm == CompressionAlgorithm::None || data.size() < settings.min_bytes ||
+        data.size() <= sizeof(CompressionHeader)) {
+        return CompressResult::Raw;
+    }
+    // Only worth sending if the frame, header included, is smaller than data.
+    const size_t capacity = data.size() - sizeof(CompressionHeader) - 1;
+    scratch.resize(sizeof(CompressionHeader) + capacity);
+    const std::optional<size_t> n = compress_raw(settings, data, scratch.data() + sizeof(CompressionHeader), capacity);
+    if (!n.has_value()) {
+        return CompressResult::Failed;
+    }
+    if (*n == 0) {
+        return CompressResult::Raw;
+    }
+    CompressionHeader header{};
+    header.magic = CompressionHeader::kMagic;
+    header.algorithm = static_cast<uint8_t>(settings.algorithm);
+    header.raw_size = static_cast<uint32_t>(data.size());
+    std::memcpy(scratch.data(), &header, sizeof(header));
+    scratch.resize(sizeof(CompressionHeader) + *n);
+    out = std::span<const std::byte>(scratch.data(), scratch.size());
+    return CompressResult::Compressed;
+}
+
+bool decompress_payload(std::span<const std::byte> wire, size_t max_size,
+                        PduBytes& scratch, std::span<const std::byte>& out)
+{
+    if (!is_compressed_frame(wire)) {
+        out = wire;
+        return true;
+    }
+    CompressionHeader header;
+    std::memcpy(&header, wire.data(), sizeof(header));
+    if (header.raw_size > max_size) {
+        return false;
+    }
+    scratch.resize(header.raw_size);
+    if (!decompress_raw(static_cast<CompressionAlgorithm>(header.algorithm), wire.subspan(sizeof(CompressionHeader)),
+                        scratch.data(), header.raw_size)) {
+        return false;
+    }
+    out = std::span<const std::byte>(scratch.data(), scratch.size());
+    return true;
+}
+
+} // namespace hakoniwa::pdu::bridge
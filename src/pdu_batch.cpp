@@ -0,0 +1,135 @@
+#include "hakoniwa/pdu/bridge/pdu_batch.hpp"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+namespace hakoniwa::pdu::bridge {
+
+PduBatch::PduBatch(std::shared_ptr<hakoniwa::pdu::Endpoint> dst,
+                   hakoniwa::pdu::PduResolvedKey carrier_key,
+                   size_t carrier_size,
+                   CompressionSettings compression)
+    : dst_(std::move(dst)),
+      carrier_key_(std::move(carrier_key)),
+      carrier_size_(carrier_size),
+      compression_(compression)
+{
+    frame_.reserve(carrier_size_);
+}
+
+bool PduBatch::append(const hakoniwa::pdu::PduResolvedKey& key, std::span<const std::byte> payload)
+{
+    const size_t record_size = sizeof(BatchRecordHeader) + key.robot.size() + payload.size();
+    if (sizeof(BatchHeader) + record_size > carrier_size_) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (frame_.size() + record_size > carrier_size_) {
+        flush_locked_();
+    }
+    if (frame_.empty()) {
+        frame_.resize(sizeof(BatchHeader));
+    }
+    const BatchRecordHeader header{
+        key.channel_id,
+        static_cast<uint32_t>(payload.size()),
+        static_cast<uint32_t>(key.robot.size())};
+    const size_t offset = frame_.size();
+    frame_.resize(offset + record_size);
+    std::byte* p = frame_.data() + offset;
+    std::memcpy(p, &header, sizeof(header));
+    std::memcpy(p + sizeof(header), key.robot.data(), key.robot.size());
+    std::memcpy(p + sizeof(header) + key.robot.size(), payload.data(), payload.size());
+    ++record_count_;
+    return true;
+}
+
+void PduBatch::flush(uint64_t now_usec)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    now_usec_ = now_usec;
+    flush_locked_();
+}
+
+void PduBatch::flush_locked_()
+{
+    if (record_count_ == 0) {
+        return;
+    }
+    const BatchHeader header{BatchHeader::kMagic, record_count_};
+    std::memcpy(frame_.data(), &header, sizeof(header));
+    std::span<const std::byte> wire(frame_.data(), frame_.size());
+    if (compress_payload(compression_, wire, compress_scratch_, wire) == CompressResult::Failed) {
+        std::cerr << "ERROR: Failed to compress batch on " << carrier_key_.robot << " channel "
+                  << carrier_key_.channel_id << "; sending it raw" << std::endl;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    HakoPduErrorType err = async_sender_
+        ? async_sender_->enqueue(carrier_key_, wire, async_feedback_, now_usec_)
+        : dst_->send(carrier_key_, wire);
+    if (backpressure_ && (!async_sender_ || err != HAKO_PDU_ERR_OK)) {
+        const auto send_usec = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        backpressure_->on_send(now_usec_, err == HAKO_PDU_ERR_OK, static_cast<uint64_t>(send_usec));
+    }
+    if (err != HAKO_PDU_ERR_OK) {
+        std::cerr << "ERROR: Failed to send batch of " << record_count_ << " PDUs on "
+                  << carrier_key_.robot << " channel " << carrier_key_.channel_id << ": " << err << std::endl;
+    }
+    else {
+        frames_sent_.fetch_add(1, std::memory_order_relaxed);
+        records_sent_.fetch_add(record_count_, std::memory_order_relaxed);
+    }
+    frame_.clear();
+    record_count_ = 0;
+}
+
+bool is_batch_frame(std::span<const std::byte> frame)
+{
+    if (frame.size() < sizeof(BatchHeader)) {
+        return false;
+    }
+    uint32_t magic = 0;
+    std::memcpy(&magic, frame.data(), sizeof(magic));
+    return magic == BatchHeader::kMagic;
+}
+
+bool for_each_batch_record(
+    std::span<const std::byte> frame,
+    const std::function<void(const hakoniwa::pdu::PduResolvedKey&, std::span<const std::byte>)>& fn)
+{
+    if (!is_batch_frame(frame)) {
+        return false;
+    }
+    BatchHeader header;
+    std::memcpy(&header, frame.data(), sizeof(header));
+    // Validate every record before delivering any, so a truncated frame never
+    // produces a partial update.
+    for (int pass = 0; pass < 2; ++pass) {
+        size_t offset = sizeof(BatchHeader);
+        for (uint32_t i = 0; i < header.record_count; ++i) {
+            BatchRecordHeader record;
+            if (frame.size() - offset < sizeof(record)) {
+                return false;
+            }
+            std::memcpy(&record, frame.data() + offset, sizeof(record));
+            offset += sizeof(record);
+            if (frame.size() - offset < static_cast<size_t>(record.robot_size) + record.payload_size) {
+                return false;
+            }
+            if (pass == 1) {
+                hakoniwa::pdu::PduResolvedKey key;
+                key.robot.assign(reinterpret_cast<const char*>(frame.data() + offset), record.robot_size);
+                key.channel_id = record.channel_id;
+                fn(key, frame.subspan(offset + record.robot_size, record.payload_size));
+            }
+            offset += record.robot_size + record.payload_size;
+        }
+        if (offset != frame.size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace hakoniwa::pdu::bridge
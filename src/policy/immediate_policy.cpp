@@ -1,37 +1,72 @@
 #include "hakoniwa/pdu/bridge/policy/immediate_policy.hpp"
-#include "hakoniwa/time_source/time_source.hpp" // For ITimeSource
+#include <bit>
 
 namespace hakoniwa::pdu::bridge {
 
-bool ImmediatePolicy::should_transfer(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& /* time_source */) {
-    if (is_atomic_) {
-        // In atomic mode, mark this PDU as received and check if all PDUs are ready.
-        auto it = recv_states_.find({pdu_key.robot, pdu_key.channel_id});
-        if (it == recv_states_.end()) {
-            return false;
-        }
-        it->second = true;
-        for (const auto& pair : recv_states_) {
-            if (!pair.second) {
-                return false; // At least one PDU has not been received yet.
-            }
+size_t ImmediatePolicy::add_pdu_key(const PduResolvedKey& pdu_key) {
+    if (!is_atomic_) {
+        return kInvalidReadySlot;
+    }
+    const uint64_t code = KeyRegistry::code(keys_->intern(pdu_key.robot), pdu_key.channel_id);
+    auto [it, inserted] = slot_index_.try_emplace(code, slot_count_);
+    if (!inserted) {
+        return it->second;
+    }
+    ++slot_count_;
+    const size_t words = (slot_count_ + 63) / 64;
+    if (words != word_count_) {
+        auto grown = std::make_unique<std::atomic<uint64_t>[]>(words);
+        for (size_t i = 0; i < word_count_; ++i) {
+            grown[i].store(ready_words_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
         }
-        return true; // All PDUs have been received.
-    } else {
+        ready_words_ = std::move(grown);
+        word_count_ = words;
+    }
+    return it->second;
+}
+
+bool ImmediatePolicy::mark_ready(size_t slot) {
+    if (!is_atomic_) {
         return true;
     }
+    if (slot >= slot_count_) {
+        return false;
+    }
+    const uint64_t bit = uint64_t{1} << (slot % 64);
+    const uint64_t prev = ready_words_[slot / 64].fetch_or(bit, std::memory_order_acq_rel);
+    if (prev & bit) {
+        return false; // already marked for this round
+    }
+    return ready_count_.fetch_add(1, std::memory_order_acq_rel) + 1 == slot_count_;
 }
 
-void ImmediatePolicy::on_transferred(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& /* time_source */) {
-    (void)pdu_key;
-    if (is_atomic_) {
-        // Reset all states for the next atomic transfer.
-        for (auto& pair : recv_states_) {
-            pair.second = false;
+void ImmediatePolicy::reset_ready() {
+    // Subtract only the bits actually cleared, so a member marked between two
+    // exchanges keeps its count for the next round.
+    for (size_t i = 0; i < word_count_; ++i) {
+        const uint64_t cleared = ready_words_[i].exchange(0, std::memory_order_acq_rel);
+        if (cleared) {
+            ready_count_.fetch_sub(static_cast<size_t>(std::popcount(cleared)), std::memory_order_acq_rel);
         }
     }
-    else {
-        // No state management needed for non-atomic mode.
+}
+
+bool ImmediatePolicy::should_transfer(const PduResolvedKey& pdu_key, const CycleContext& /* ctx */) {
+    if (!is_atomic_) {
+        return true;
+    }
+    // Key-based entry for callers that do not keep their slot.
+    const NameId robot = keys_->find(pdu_key.robot);
+    if (robot == kInvalidNameId) {
+        return false;
+    }
+    auto it = slot_index_.find(KeyRegistry::code(robot, pdu_key.channel_id));
+    return it != slot_index_.end() && mark_ready(it->second);
+}
+
+void ImmediatePolicy::on_transferred(const PduResolvedKey& /* pdu_key */, const CycleContext& /* ctx */) {
+    if (is_atomic_) {
+        reset_ready();
     }
 }
 
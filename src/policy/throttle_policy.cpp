@@ -1,27 +1,34 @@
 #include "hakoniwa/pdu/bridge/policy/throttle_policy.hpp"
-#include "hakoniwa/time_source/time_source.hpp" // For ITimeSource
 
 namespace hakoniwa::pdu::bridge {
 
-ThrottlePolicy::ThrottlePolicy(uint64_t interval_microseconds)
+ThrottlePolicy::ThrottlePolicy(uint64_t interval_microseconds, bool trailing)
     : interval_micros_(interval_microseconds),
+      trailing_(trailing),
       last_transfer_time_micros_(0),
       has_transferred_(false) {}
 
-bool ThrottlePolicy::should_transfer(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& time_source) {
+bool ThrottlePolicy::should_transfer(const PduResolvedKey& pdu_key, const CycleContext& ctx) {
     if (!has_transferred_.load()) {
         return true;
     }
-    uint64_t now = time_source->get_microseconds();
+    const uint64_t now = ctx.now_usec;
     if ((now - last_transfer_time_micros_.load()) >= interval_micros_) {
         return true;
     }
     return false;
 }
 
-void ThrottlePolicy::on_transferred(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& time_source) {
-    last_transfer_time_micros_ = time_source->get_microseconds();
+void ThrottlePolicy::on_transferred(const PduResolvedKey& pdu_key, const CycleContext& ctx) {
+    last_transfer_time_micros_ = ctx.now_usec;
     has_transferred_ = true;
 }
 
+uint64_t ThrottlePolicy::next_deadline_usec() const {
+    if (!has_transferred_.load()) {
+        return 0;
+    }
+    return last_transfer_time_micros_.load() + interval_micros_;
+}
+
 } // namespace hakoniwa::pdu::bridge
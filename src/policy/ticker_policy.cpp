@@ -1,25 +1,45 @@
 #include "hakoniwa/pdu/bridge/policy/ticker_policy.hpp"
-#include "hakoniwa/time_source/time_source.hpp" // For ITimeSource
+#include <algorithm>
 
 namespace hakoniwa::pdu::bridge {
 
-TickerPolicy::TickerPolicy(uint64_t interval)
-    : interval_(interval), initialized_(false) {}
+TickerPolicy::TickerPolicy(uint64_t interval, uint64_t phase_offset, TickerSchedule schedule)
+    : interval_(interval), phase_offset_(interval ? phase_offset % interval : 0), schedule_(schedule), initialized_(false)
+{
+    schedule_.max_burst = std::max<uint32_t>(schedule_.max_burst, 1);
+}
 
-bool TickerPolicy::should_transfer(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& time_source) {
-    uint64_t now = time_source->get_microseconds();
+bool TickerPolicy::should_transfer(const PduResolvedKey& pdu_key, const CycleContext& ctx) {
+    const uint64_t now = ctx.now_usec;
     if (!initialized_) {
         // On the first check, set the initial tick time but do not trigger a transfer.
         // The first transfer will occur after the first interval has passed.
-        next_tick_time_ = now + interval_;
+        next_tick_time_ = now + interval_ + phase_offset_;
         initialized_ = true;
         return false;
     }
-    return now >= next_tick_time_;
+    if (now < next_tick_time_) {
+        return false;
+    }
+    if (schedule_.fixed_rate && interval_ > 0) {
+        // Ticks owed, including the one being served now.
+        const uint64_t owed = (now - next_tick_time_) / interval_ + 1;
+        const uint64_t allowed = schedule_.catch_up == TickerCatchUp::Burst ? schedule_.max_burst : 1;
+        if (owed > allowed) {
+            const uint64_t dropped = owed - allowed;
+            next_tick_time_ += dropped * interval_;
+            missed_ticks_.fetch_add(dropped, std::memory_order_relaxed);
+        }
+    }
+    return true;
 }
 
-void TickerPolicy::on_transferred(const PduResolvedKey& pdu_key, const std::shared_ptr<hakoniwa::time_source::ITimeSource>& time_source) {
-    uint64_t now = time_source->get_microseconds();
+void TickerPolicy::on_transferred(const PduResolvedKey& pdu_key, const CycleContext& ctx) {
+    if (schedule_.fixed_rate) {
+        next_tick_time_ += interval_;
+        return;
+    }
+    const uint64_t now = ctx.now_usec;
     next_tick_time_ = now + interval_;
 }
 
@@ -0,0 +1,184 @@
+#include "hakoniwa/pdu/bridge/source_snapshot.hpp"
+#include <algorithm>
+
+namespace hakoniwa::pdu::bridge {
+
+SourceSnapshot::SlotId SourceSnapshot::register_key(const hakoniwa::pdu::PduResolvedKey& key, size_t pdu_size)
+{
+    const NameId robot = keys_->intern(key.robot);
+    const auto& shared_key = keys_->resolved_key(robot, key.channel_id);
+    Entry* entry = nullptr;
+    SlotId slot = kInvalidSlot;
+    {
+        std::lock_guard<std::mutex> lock(entries_mtx_);
+        auto it = slot_index_.find(KeyRegistry::code(robot, key.channel_id));
+        if (it != slot_index_.end()) {
+            return it->second;
+        }
+        slot = static_cast<SlotId>(entries_.size());
+        auto created = std::make_unique<Entry>();
+        created->key = &shared_key;
+        created->pdu_size = pdu_size;
+        created->buffer = std::make_shared<PduBytes>();
+        created->buffer->reserve(pdu_size);
+        entry = created.get();
+        entries_.push_back(std::move(created));
+        slot_index_.emplace(KeyRegistry::code(robot, key.channel_id), slot);
+        key_count_.store(entries_.size(), std::memory_order_release);
+    }
+    if (!endpoint_) {
+        return slot;
+    }
+    // Entries are never erased, so the raw entry pointer stays valid for as long
+    // as the snapshot itself is alive.
+    std::weak_ptr<SourceSnapshot> weak_self = weak_from_this();
+    endpoint_->subscribe_on_recv_callback(
+        shared_key,
+        [weak_self, entry](const hakoniwa::pdu::PduResolvedKey& pdu_key, std::span<const std::byte> data) {
+            if (auto self = weak_self.lock()) {
+                self->on_recv_(*entry, pdu_key, data);
+            }
+        });
+    return slot;
+}
+
+SourceSnapshot::SlotId SourceSnapshot::find_slot(const hakoniwa::pdu::PduResolvedKey& key) const
+{
+    const NameId robot = keys_->find(key.robot);
+    if (robot == kInvalidNameId) {
+        return kInvalidSlot;
+    }
+    std::lock_guard<std::mutex> lock(entries_mtx_);
+    auto it = slot_index_.find(KeyRegistry::code(robot, key.channel_id));
+    return it == slot_index_.end() ? kInvalidSlot : it->second;
+}
+
+SourceSnapshot::ListenerId SourceSnapshot::add_listener(SlotId slot, Listener listener)
+{
+    Entry* entry = slot_(slot);
+    if (!entry) {
+        return 0;
+    }
+    ListenerId id = 0;
+    {
+        std::lock_guard<std::mutex> lock(entries_mtx_);
+        id = next_listener_id_++;
+    }
+    std::lock_guard<std::mutex> lock(entry->listener_mtx);
+    entry->listeners.emplace_back(id, std::move(listener));
+    return id;
+}
+
+void SourceSnapshot::remove_listener(ListenerId id)
+{
+    if (id == 0) {
+        return;
+    }
+    std::vector<Entry*> entries;
+    {
+        std::lock_guard<std::mutex> lock(entries_mtx_);
+        entries.reserve(entries_.size());
+        for (auto& entry : entries_) {
+            entries.push_back(entry.get());
+        }
+    }
+    // Never hold entries_mtx_ while taking a listener lock: listeners call
+    // read(), which takes entries_mtx_ while the listener lock is held.
+    for (auto* entry : entries) {
+        std::lock_guard<std::mutex> lock(entry->listener_mtx);
+        auto it = std::find_if(entry->listeners.begin(), entry->listeners.end(),
+            [id](const auto& l) { return l.first == id; });
+        if (it != entry->listeners.end()) {
+            entry->listeners.erase(it);
+            return;
+        }
+    }
+}
+
+HakoPduErrorType SourceSnapshot::read(SlotId slot, PduBufferPtr& out_buffer, size_t& out_received_size)
+{
+    Entry* entry = slot_(slot);
+    if (!entry || !endpoint_) {
+        return HAKO_PDU_ERR_NO_ENTRY;
+    }
+    const uint64_t cycle = cycle_.load(std::memory_order_acquire);
+    std::lock_guard<std::mutex> lock(entry->data_mtx);
+    if (!entry->cached || entry->cached_cycle != cycle || entry->cached_sequence != entry->sequence) {
+        // Refill in place unless a reader still holds the previous payload.
+        if (entry->buffer.use_count() != 1) {
+            entry->buffer = std::make_shared<PduBytes>();
+            entry->buffer->reserve(entry->pdu_size);
+        }
+        // Grow to the declared size for recv(), then trim to what arrived. The
+        // capacity is kept, so neither step allocates in steady state.
+        entry->buffer->resize(entry->pdu_size);
+        size_t received_size = 0;
+        entry->cached_error = endpoint_->recv(*entry->key, std::span<std::byte>(*entry->buffer), received_size);
+        endpoint_reads_.fetch_add(1, std::memory_order_relaxed);
+        if (entry->cached_error != HAKO_PDU_ERR_OK || received_size > entry->pdu_size) {
+            received_size = 0;
+        }
+        entry->buffer->resize(received_size);
+        entry->high_water_mark = std::max(entry->high_water_mark, received_size);
+        entry->received_size = received_size;
+        entry->cached = true;
+        entry->cached_cycle = cycle;
+        entry->cached_sequence = entry->sequence;
+    }
+    if (entry->cached_error != HAKO_PDU_ERR_OK) {
+        return entry->cached_error;
+    }
+    out_buffer = entry->buffer;
+    out_received_size = entry->received_size;
+    return HAKO_PDU_ERR_OK;
+}
+
+uint64_t SourceSnapshot::sequence(SlotId slot) const
+{
+    Entry* entry = slot_(slot);
+    if (!entry) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(entry->data_mtx);
+    return entry->sequence;
+}
+
+size_t SourceSnapshot::high_water_mark(SlotId slot) const
+{
+    Entry* entry = slot_(slot);
+    if (!entry) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(entry->data_mtx);
+    return entry->high_water_mark;
+}
+
+SourceSnapshot::Entry* SourceSnapshot::slot_(SlotId slot) const
+{
+    std::lock_guard<std::mutex> lock(entries_mtx_);
+    if (slot >= entries_.size()) {
+        return nullptr;
+    }
+    return entries_[slot].get();
+}
+
+void SourceSnapshot::on_recv_(Entry& entry, const hakoniwa::pdu::PduResolvedKey& key, std::span<const std::byte> data)
+{
+    {
+        std::lock_guard<std::mutex> lock(entry.data_mtx);
+        ++entry.sequence;
+        entry.high_water_mark = std::max(entry.high_water_mark, data.size());
+    }
+    events_.fetch_add(1, std::memory_order_acq_rel);
+    {
+        std::lock_guard<std::mutex> lock(entry.listener_mtx);
+        for (auto& [_, listener] : entry.listeners) {
+            listener(key, data);
+        }
+    }
+    if (wakeup_) {
+        wakeup_->notify();
+    }
+}
+
+} // namespace hakoniwa::pdu::bridge
@@ -1,21 +1,33 @@
 #include "hakoniwa/pdu/bridge/transfer_pdu.hpp"
-#include "hakoniwa/time_source/time_source.hpp" // For ITimeSource
+#include "hakoniwa/pdu/bridge/pdu_hash.hpp"
 #include "hakoniwa/pdu/bridge/policy/immediate_policy.hpp"
 #include "hakoniwa/pdu/pdu_primitive_ctypes.h"
+#include <algorithm>
 #include <iostream>
 #include <vector> // For std::vector<std::byte>
 
+namespace {
+uint64_t elapsed_ns(std::chrono::steady_clock::time_point start)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+// Stands in for the registry keys of a transfer built without endpoints.
+const hakoniwa::pdu::PduResolvedKey kUnresolvedKey{.robot = "", .channel_id = -1};
+} // namespace
+
 hakoniwa::pdu::bridge::TransferPdu::TransferPdu(
     const hakoniwa::pdu::bridge::PduKey& config_key,
     std::shared_ptr<IPduTransferPolicy> policy,
-    std::shared_ptr<hakoniwa::time_source::ITimeSource> time_source,
-    std::shared_ptr<hakoniwa::pdu::Endpoint> src,
+    std::shared_ptr<CycleClock> clock,
+    std::shared_ptr<SourceSnapshot> src,
     std::shared_ptr<hakoniwa::pdu::Endpoint> dst)
-    : config_pdu_key_(config_key),
-      endpoint_pdu_key_({config_key.robot_name, config_key.pdu_name}), // Convert to endpoint PduKey
+    : src_key_(&kUnresolvedKey),
+      dst_key_(&kUnresolvedKey),
       policy_(policy),
-      time_source_(time_source),
-      src_endpoint_(src),
+      clock_(clock),
+      src_snapshot_(src),
+      src_endpoint_(src ? src->endpoint() : nullptr),
       dst_endpoint_(dst),
       is_active_(true),
       owner_epoch_(0) {
@@ -23,39 +35,42 @@ hakoniwa::pdu::bridge::TransferPdu::TransferPdu(
         is_active_ = false;
         return;
     }
-    auto channel_id = src->get_pdu_channel_id(endpoint_pdu_key_);
-    endpoint_pdu_resolved_key_ = {
-        .robot = endpoint_pdu_key_.robot,
-        .channel_id = channel_id
-    };
-    PduResolvedKey pdu_resolved_key{
-        .robot = endpoint_pdu_key_.robot,
-        .channel_id = channel_id
-    };
+    auto& keys = *src_snapshot_->keys();
+    key_id_ = keys.intern_pdu(config_key.robot_name, config_key.pdu_name);
+    const hakoniwa::pdu::PduKey endpoint_key{config_key.robot_name, config_key.pdu_name};
+    src_key_ = &keys.resolved_key(key_id_.robot, src_endpoint_->get_pdu_channel_id(endpoint_key));
+    dst_key_ = &keys.resolved_key(key_id_.robot, dst_endpoint_->get_pdu_channel_id(endpoint_key));
+    pdu_size_ = src_endpoint_->get_pdu_size(endpoint_key);
+    // The snapshot owns the endpoint subscription for every key it reads, which
+    // also keeps the endpoint "no subscribers" log quiet for cyclic policies.
+    src_slot_ = src_snapshot_->register_key(*src_key_, pdu_size_);
     if (!policy_->is_cyclic_trigger()) {
         // Register callback for event-driven triggers
         #ifdef ENABLE_DEBUG_MESSAGES
         std::cout << "INFO: Registering PDU for event-driven transfer: "
-                  << " robot=" << pdu_resolved_key.robot
+                  << " robot=" << src_key_->robot
                   << " pdu_name=" << config_key.pdu_name
-                  << " channel=" << pdu_resolved_key.channel_id
+                  << " channel=" << src_key_->channel_id
                   << std::endl;
         #endif
-        src_endpoint_->subscribe_on_recv_callback(
-            pdu_resolved_key,
+        listener_id_ = src_snapshot_->add_listener(
+            src_slot_,
             [this](const hakoniwa::pdu::PduResolvedKey& pdu_key, std::span<const std::byte> data) {
                 this->on_recv_callback(pdu_key, data);
             }
         );
-    } else {
-        // Suppress endpoint "no subscribers" log for cyclic policies (e.g., ticker).
-        src_endpoint_->subscribe_on_recv_callback(
-            pdu_resolved_key,
-            [](const hakoniwa::pdu::PduResolvedKey&, std::span<const std::byte>) {}
-        );
     }
     if (auto immediate_policy = std::dynamic_pointer_cast<ImmediatePolicy>(policy_)) {
-        immediate_policy->add_pdu_key(endpoint_pdu_resolved_key_);
+        immediate_policy->add_pdu_key(*src_key_);
+    }
+    if (auto throttle_policy = std::dynamic_pointer_cast<ThrottlePolicy>(policy_); throttle_policy && throttle_policy->trailing()) {
+        trailing_ = std::move(throttle_policy);
+    }
+}
+
+hakoniwa::pdu::bridge::TransferPdu::~TransferPdu() {
+    if (src_snapshot_) {
+        src_snapshot_->remove_listener(listener_id_);
     }
 }
 
@@ -63,143 +78,529 @@ void hakoniwa::pdu::bridge::TransferPdu::set_active(bool is_active) {
     is_active_ = is_active;
 }
 
+void hakoniwa::pdu::bridge::TransferPdu::enable_dedupe(uint64_t refresh_usec) {
+    dedupe_enabled_ = true;
+    dedupe_refresh_usec_ = refresh_usec;
+}
+
+void hakoniwa::pdu::bridge::TransferPdu::enable_delta_encode(uint32_t keyframe_interval) {
+    delta_decoder_.reset();
+    delta_encoder_ = std::make_unique<DeltaEncoder>(keyframe_interval);
+}
+
+void hakoniwa::pdu::bridge::TransferPdu::enable_delta_decode() {
+    delta_encoder_.reset();
+    delta_decoder_ = std::make_unique<DeltaDecoder>();
+}
+
+void hakoniwa::pdu::bridge::TransferPdu::enable_compression(const CompressionSettings& settings) {
+    compression_ = settings;
+}
+
+void hakoniwa::pdu::bridge::TransferPdu::enable_decompression() {
+    decompress_ = true;
+}
+
 void hakoniwa::pdu::bridge::TransferPdu::set_epoch(uint8_t epoch) {
     owner_epoch_.store(epoch, std::memory_order_relaxed);
 }
 
-void hakoniwa::pdu::bridge::TransferPdu::try_transfer() {
+void hakoniwa::pdu::bridge::TransferPdu::try_transfer(const CycleContext& ctx, std::span<const std::byte> event_data) {
     if (!is_active_) {
         return;
     }
-    if (policy_->should_transfer(endpoint_pdu_resolved_key_, time_source_)) {
+    if (policy_->should_transfer(*src_key_, ctx)) {
+        if (trailing_) {
+            trailing_pending_.store(false); // this send carries the newest value
+        }
         #ifdef ENABLE_DEBUG_MESSAGES
-        std::cout << "INFO: Bridge transfer triggered: " << config_pdu_key_.id
+        std::cout << "INFO: Bridge transfer triggered: " << label_()
                   << " src=" << src_endpoint_->get_name()
                   << " dst=" << dst_endpoint_->get_name()
-                  << " robot=" << endpoint_pdu_resolved_key_.robot
-                  << " channel=" << endpoint_pdu_resolved_key_.channel_id
+                  << " channel=" << src_key_->channel_id
                   << std::endl;
         #endif
-        transfer();
-        policy_->on_transferred(endpoint_pdu_resolved_key_, time_source_);
+        if (!event_data.empty()) {
+            if (backpressure_ && !backpressure_->admit(ctx.now_usec)) {
+                coalesce_(event_data, false);
+            }
+            else {
+                // Zero-copy: the callback already carries the payload.
+                forward(ctx, event_data);
+            }
+        }
+        else {
+            transfer(ctx);
+        }
+        policy_->on_transferred(*src_key_, ctx);
+    }
+    else if (trailing_ && !trailing_pending_.exchange(true)) {
+        // Sent by cyclic_trigger() when the window closes; until now the
+        // connection only checked back once per interval.
+        trailing_check_usec_.store(trailing_->next_deadline_usec());
+        if (deadline_changed_) {
+            deadline_changed_->store(true, std::memory_order_release);
+        }
     }
 }
 
-void hakoniwa::pdu::bridge::TransferPdu::transfer() {
-    size_t pdu_size = src_endpoint_->get_pdu_size(
-        endpoint_pdu_key_
-    );
-
-    if (pdu_size == 0) {
-        std::cerr << "ERROR: PDU size is 0 for " << endpoint_pdu_key_.robot 
-                  << "." << endpoint_pdu_key_.pdu << ". Skipping transfer." << std::endl;
-        return;
+bool hakoniwa::pdu::bridge::TransferPdu::transfer(const CycleContext& ctx) {
+    if (pdu_size_ == 0) {
+        std::cerr << "ERROR: PDU size is 0 for " << label_() << ". Skipping transfer." << std::endl;
+        return false;
+    }
+    // Sequence first: an event racing with the read below can only cause a
+    // duplicate on the next tick, never a lost update.
+    const uint64_t sequence = src_snapshot_->sequence(src_slot_);
+    if (policy_->requires_new_data() && sequence == last_sent_sequence_) {
+        unchanged_skips_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (backpressure_ && !backpressure_->admit(ctx.now_usec)) {
+        // Congested: the source is read once the destination recovers.
+        coalesce_({}, true);
+        return false;
     }
 
-    std::vector<std::byte> buffer(pdu_size); // Use std::byte for raw PDU data
-
+    PduBufferPtr buffer;
     size_t received_size = 0;
-    // Read from source endpoint
-    HakoPduErrorType read_err = src_endpoint_->recv(
-        endpoint_pdu_key_, std::span<std::byte>(buffer), received_size
-    );
+    // Read from the per-cycle source snapshot (shared with every other destination)
+    HakoPduErrorType read_err = src_snapshot_->read(src_slot_, buffer, received_size);
 
     if (read_err != HAKO_PDU_ERR_OK) {
-        std::cerr << "ERROR: Failed to read PDU " << endpoint_pdu_key_.robot 
-                  << "." << endpoint_pdu_key_.pdu << " from source: " << read_err << std::endl;
-        return;
+        std::cerr << "ERROR: Failed to read PDU " << label_() << " from source: " << read_err << std::endl;
+        return false;
     }
-    if (received_size > pdu_size) {
-         std::cerr << "WARNING: PDU " << endpoint_pdu_key_.robot 
-                  << "." << endpoint_pdu_key_.pdu << " read " << received_size 
-                  << " bytes, expected " << pdu_size << std::endl;
+    if (received_size == 0) {
+        return false;
     }
 
+    // Only the bytes actually received go on the wire (variable-length PDUs).
+    deferred_ = false;
+    if (!forward(ctx, std::span<const std::byte>(buffer->data(), received_size), true)) {
+        return false;
+    }
+    last_sent_sequence_ = sequence;
+    cyclic_coalesced_ = false; // already newer than anything held back
+    return true;
+}
 
-    if (epoch_validation_) {
-        uint8_t pdu_epoch = 0;
-        if (hako_pdu_get_epoch(buffer.data(), &pdu_epoch) != 0) {
-            std::cerr << "ERROR: Failed to get epoch from PDU "
-                      << endpoint_pdu_key_.robot << "." << endpoint_pdu_key_.pdu << std::endl;
-            return;
+bool hakoniwa::pdu::bridge::TransferPdu::forward(const CycleContext& ctx, std::span<const std::byte> data, bool cyclic) {
+    const std::span<const std::byte> input = data; // what coalesce_() holds back
+    // The codec buffers back the spans below, so the lock is held until sent.
+    const bool compressing = compression_.algorithm != CompressionAlgorithm::None;
+    std::unique_lock<std::mutex> codec_lock;
+    if (delta_encoder_ || delta_decoder_ || compressing || decompress_) {
+        codec_lock = std::unique_lock<std::mutex>(codec_mtx_);
+    }
+    if (decompress_) {
+        const auto start = std::chrono::steady_clock::now();
+        const bool ok = decompress_payload(data, pdu_size_, decompress_scratch_, data);
+        decompress_ns_.fetch_add(elapsed_ns(start), std::memory_order_relaxed);
+        if (!ok) {
+            std::cerr << "ERROR: Failed to decompress PDU " << label_() << std::endl;
+            return false;
         }
-        if (pdu_epoch != owner_epoch_.load(std::memory_order_relaxed)) {
+    }
+    if (unbatch_ && is_batch_frame(data)) {
+        remember_latest_(input);
+        return forward_batch_(data);
+    }
+    if (delta_decoder_) {
+        std::span<const std::byte> decoded;
+        if (!delta_decoder_->decode(data, decoded)) {
             #ifdef ENABLE_DEBUG_MESSAGES
-            std::cout << "DEBUG: Discarding PDU " << config_pdu_key_.id
-                      << " (epoch " << static_cast<int>(pdu_epoch)
-                      << ", owner " << static_cast<int>(owner_epoch_.load(std::memory_order_relaxed)) << ")" << std::endl;
+            std::cout << "DEBUG: Dropping delta for " << label_()
+                      << " (keyframe not received)" << std::endl;
             #endif
-            return;
+            return false;
         }
+        data = decoded;
+    }
+    if (data.size() > pdu_size_) {
+        std::cerr << "WARNING: PDU " << label_() << " carries " << data.size()
+                  << " bytes, expected at most " << pdu_size_ << std::endl;
+        return false;
     }
+    if (!epoch_matches_(data)) {
+        return false;
+    }
+    // Kept even while the destination is down: that is when it matters.
+    remember_latest_(input);
 
     bool destination_running = false;
     HakoPduErrorType running_err = dst_endpoint_->is_running(destination_running);
     if (running_err == HAKO_PDU_ERR_OK && !destination_running) {
-        return;
+        return false;
+    }
+
+    std::unique_lock<std::mutex> dedupe_lock;
+    uint64_t hash = 0;
+    if (dedupe_enabled_) {
+        hash = hash_pdu_bytes(data);
+        dedupe_lock = std::unique_lock<std::mutex>(dedupe_mtx_);
+        if (async_feedback_) {
+            // The sender lost a queued payload; it may have been the last one.
+            const uint64_t lost = async_feedback_->lost.load(std::memory_order_acquire);
+            if (lost != dedupe_seen_lost_) {
+                dedupe_seen_lost_ = lost;
+                dedupe_has_last_ = false;
+            }
+        }
+        const bool refresh_due = dedupe_refresh_usec_ > 0 &&
+            ctx.now_usec - dedupe_last_send_usec_ >= dedupe_refresh_usec_;
+        if (dedupe_has_last_ && hash == dedupe_last_hash_ && !refresh_due) {
+            dedupe_suppressed_.fetch_add(1, std::memory_order_relaxed);
+            return true; // the destination already holds these bytes
+        }
+    }
+
+    // Charged before encoding, so a deferred or dropped send never advances
+    // the delta keyframe chain.
+    if (budget_) {
+        const BudgetDecision decision = budget_->admit(ctx.now_usec, data.size(), priority_, cyclic);
+        if (decision == BudgetDecision::Defer) {
+            deferred_ = true; // only ever returned on the cyclic path
+        }
+        if (decision != BudgetDecision::Send) {
+            return false;
+        }
     }
 
-    // Write to destination endpoint
-    HakoPduErrorType write_err = dst_endpoint_->send(
-        endpoint_pdu_key_, std::span<const std::byte>(buffer)
-    );
+    // A keyframe lost after this point is recovered at the next keyframe;
+    // deltas naming an unknown keyframe are dropped by the receiver.
+    std::span<const std::byte> wire = delta_encoder_ ? delta_encoder_->encode(data) : data;
+    if (compressing) {
+        const size_t in_bytes = wire.size();
+        const auto start = std::chrono::steady_clock::now();
+        const CompressResult result = compress_payload(compression_, wire, compress_scratch_, wire);
+        compress_ns_.fetch_add(elapsed_ns(start), std::memory_order_relaxed);
+        if (result == CompressResult::Failed) {
+            // wire is still the uncompressed payload, which receivers accept.
+            compress_errors_.fetch_add(1, std::memory_order_relaxed);
+            std::cerr << "ERROR: Failed to compress PDU " << label_() << "; sending it raw" << std::endl;
+        }
+        compressed_in_bytes_.fetch_add(in_bytes, std::memory_order_relaxed);
+        compressed_out_bytes_.fetch_add(wire.size(), std::memory_order_relaxed);
+    }
+
+    // Write to destination endpoint (or queue it on the cycle's batch frame)
+    HakoPduErrorType write_err = HAKO_PDU_ERR_OK;
+    if (!(cyclic && batch_ && batch_->append(*dst_key_, wire))) {
+        const auto send_start = backpressure_ ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+        bool dropped = false;
+        if (async_sender_) {
+            // BUSY: dropped by the overflow policy, which keeps its own count.
+            dropped = async_sender_->enqueue(*dst_key_, wire, async_feedback_, ctx.now_usec) != HAKO_PDU_ERR_OK;
+        }
+        else {
+            write_err = dst_endpoint_->send(*dst_key_, wire);
+        }
+        if (backpressure_) {
+            const bool ok = !dropped && write_err == HAKO_PDU_ERR_OK;
+            if (!async_sender_ || !ok) {
+                // A queued payload is reported by the sender thread once sent.
+                backpressure_->on_send(ctx.now_usec, ok, elapsed_ns(send_start) / 1000);
+            }
+            if (!ok) {
+                // Keep the value instead of losing it; it goes out on recovery.
+                coalesce_(input, cyclic);
+                return false;
+            }
+        }
+        if (dropped) {
+            return false;
+        }
+    }
 
     if (write_err != HAKO_PDU_ERR_OK) {
-        std::cerr << "ERROR: Failed to write PDU " << endpoint_pdu_key_.robot 
-                  << "." << endpoint_pdu_key_.pdu << " to destination: " << write_err << std::endl;
-        return;
+        std::cerr << "ERROR: Failed to write PDU " << label_() << " to destination: " << write_err << std::endl;
+        return false;
     }
+    if (dedupe_enabled_) {
+        dedupe_has_last_ = true;
+        dedupe_last_hash_ = hash;
+        dedupe_last_send_usec_ = ctx.now_usec;
+    }
+    if (backpressure_ && !cyclic) {
+        // A held-back event is older than what was just sent.
+        std::lock_guard<std::mutex> lock(coalesce_mtx_);
+        has_coalesced_ = false;
+    }
+    transfers_.fetch_add(1, std::memory_order_relaxed);
     #ifdef ENABLE_DEBUG_MESSAGES
-    std::cout << "INFO: Bridge transfer completed: " << config_pdu_key_.id
-              << " bytes=" << received_size
+    std::cout << "INFO: Bridge transfer completed: " << label_()
+              << " bytes=" << wire.size()
               << " src=" << src_endpoint_->get_name()
               << " dst=" << dst_endpoint_->get_name()
               << std::endl;
     #endif
+    return true;
+}
+
+bool hakoniwa::pdu::bridge::TransferPdu::epoch_matches_(std::span<const std::byte> data) const {
+    if (!epoch_validation_) {
+        return true;
+    }
+    uint8_t pdu_epoch = 0;
+    if (hako_pdu_get_epoch(data.data(), &pdu_epoch) != 0) {
+        std::cerr << "ERROR: Failed to get epoch from PDU "
+                  << label_() << std::endl;
+        return false;
+    }
+    if (pdu_epoch != owner_epoch_.load(std::memory_order_relaxed)) {
+        #ifdef ENABLE_DEBUG_MESSAGES
+        std::cout << "DEBUG: Discarding PDU " << label_()
+                  << " (epoch " << static_cast<int>(pdu_epoch)
+                  << ", owner " << static_cast<int>(owner_epoch_.load(std::memory_order_relaxed)) << ")" << std::endl;
+        #endif
+        return false;
+    }
+    return true;
+}
+
+bool hakoniwa::pdu::bridge::TransferPdu::forward_batch_(std::span<const std::byte> frame) {
+    bool destination_running = false;
+    HakoPduErrorType running_err = dst_endpoint_->is_running(destination_running);
+    if (running_err == HAKO_PDU_ERR_OK && !destination_running) {
+        return false;
+    }
+    // Records keep the channel ids of the sending bridge; they are written as
+    // is, each checked against the size the destination declares for it and
+    // subject to the connection's epoch validation.
+    const bool ok = for_each_batch_record(frame,
+        [this](const hakoniwa::pdu::PduResolvedKey& key, std::span<const std::byte> payload) {
+            if (payload.empty()) {
+                return;
+            }
+            const size_t declared = record_size_(key);
+            if (payload.size() > declared) {
+                std::cerr << "WARNING: Batched PDU " << key.robot << " channel " << key.channel_id
+                          << " carries " << payload.size() << " bytes, destination declares "
+                          << declared << std::endl;
+                return;
+            }
+            if (!epoch_matches_(payload)) {
+                return;
+            }
+            HakoPduErrorType write_err = dst_endpoint_->send(key, payload);
+            if (write_err != HAKO_PDU_ERR_OK) {
+                std::cerr << "ERROR: Failed to write batched PDU " << key.robot
+                          << " channel " << key.channel_id << " to destination: " << write_err << std::endl;
+                return;
+            }
+            transfers_.fetch_add(1, std::memory_order_relaxed);
+        });
+    if (!ok) {
+        std::cerr << "ERROR: Malformed batch frame on " << label_() << std::endl;
+    }
+    return ok;
+}
+
+size_t hakoniwa::pdu::bridge::TransferPdu::record_size_(const hakoniwa::pdu::PduResolvedKey& key) {
+    std::lock_guard<std::mutex> lock(record_sizes_mtx_);
+    for (const auto& [known, size] : record_sizes_) {
+        if (known.channel_id == key.channel_id && known.robot == key.robot) {
+            return size;
+        }
+    }
+    const std::string name = dst_endpoint_->get_pdu_name(key);
+    const size_t size = name.empty() ? 0 : dst_endpoint_->get_pdu_size({key.robot, name});
+    record_sizes_.emplace_back(key, size);
+    return size;
+}
+
+void hakoniwa::pdu::bridge::TransferPdu::coalesce_(std::span<const std::byte> data, bool cyclic) {
+    if (cyclic) {
+        backpressure_->note_coalesced(cyclic_coalesced_);
+        cyclic_coalesced_ = true;
+        return;
+    }
+    std::lock_guard<std::mutex> lock(coalesce_mtx_);
+    backpressure_->note_coalesced(has_coalesced_);
+    coalesced_.assign(data.begin(), data.end());
+    has_coalesced_ = true;
+}
+
+void hakoniwa::pdu::bridge::TransferPdu::remember_latest_(std::span<const std::byte> data) {
+    if (!presence_) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(latest_mtx_);
+    latest_.assign(data.begin(), data.end());
+    has_latest_ = true;
+}
+
+void hakoniwa::pdu::bridge::TransferPdu::replay_latest(const CycleContext& ctx) {
+    if (!presence_ || !is_active_) {
+        return;
+    }
+    const uint64_t joins = presence_->joins();
+    if (joins == replayed_joins_) {
+        return;
+    }
+    replayed_joins_ = joins;
+    PduBytes latest;
+    {
+        std::lock_guard<std::mutex> lock(latest_mtx_);
+        if (!has_latest_) {
+            return;
+        }
+        latest = latest_;
+    }
+    // The newcomer holds nothing yet: neither an earlier copy of these bytes
+    // nor the keyframe the next delta would refer to.
+    if (dedupe_enabled_) {
+        std::lock_guard<std::mutex> lock(dedupe_mtx_);
+        dedupe_has_last_ = false;
+    }
+    if (delta_encoder_) {
+        std::lock_guard<std::mutex> lock(codec_mtx_);
+        delta_encoder_->force_keyframe();
+    }
+    const std::span<const std::byte> data(latest.data(), latest.size());
+    if (backpressure_ && !backpressure_->admit(ctx.now_usec)) {
+        coalesce_(data, false);
+        return;
+    }
+    if (forward(ctx, data)) {
+        presence_->note_replayed();
+    }
+}
+
+void hakoniwa::pdu::bridge::TransferPdu::flush_trailing_(const CycleContext& ctx) {
+    if (!is_active_) {
+        trailing_pending_.store(false); // dropped, as the event path drops it
+    }
+    else if (trailing_pending_.load() && policy_->should_transfer(*src_key_, ctx)) {
+        // Cleared before the read: an event racing with it is sent next window.
+        trailing_pending_.store(false);
+        const bool sent = transfer(ctx);
+        if (deferred_) {
+            trailing_pending_.store(true); // retried every cycle, like a tick
+        }
+        else {
+            if (sent) {
+                trailing_sends_.fetch_add(1, std::memory_order_relaxed);
+            }
+            policy_->on_transferred(*src_key_, ctx);
+        }
+    }
+    // Pending: check again when the window closes. Idle: look once per
+    // interval; an event holding a value back pulls the check in to the end
+    // of its window. Stored before pending is re-read, so such an event is
+    // never overwritten.
+    const uint64_t window_end = trailing_->next_deadline_usec();
+    trailing_check_usec_.store(std::max(window_end, ctx.now_usec + trailing_->interval_usec()));
+    if (trailing_pending_.load()) {
+        trailing_check_usec_.store(window_end);
+    }
+}
+
+void hakoniwa::pdu::bridge::TransferPdu::flush_coalesced(const CycleContext& ctx) {
+    if (!backpressure_ || !is_active_) {
+        return;
+    }
+    if (cyclic_coalesced_) {
+        cyclic_coalesced_ = false;
+        if (transfer(ctx)) {
+            backpressure_->note_flushed();
+        }
+    }
+    PduBytes pending;
+    {
+        std::lock_guard<std::mutex> lock(coalesce_mtx_);
+        if (!has_coalesced_) {
+            return;
+        }
+        pending.swap(coalesced_);
+        has_coalesced_ = false;
+    }
+    if (forward(ctx, std::span<const std::byte>(pending.data(), pending.size()))) {
+        backpressure_->note_flushed();
+    }
+}
+
+std::string hakoniwa::pdu::bridge::TransferPdu::label_() const
+{
+    return src_snapshot_ ? src_snapshot_->keys()->label(key_id_) : std::string();
+}
+
+void hakoniwa::pdu::bridge::TransferPdu::accumulate_counters(const PduKeyId& key, TransferCounters& out) const
+{
+    if (key_id_.robot == kInvalidNameId || !(key_id_ == key)) {
+        return;
+    }
+    out.transfers += transfers_.load(std::memory_order_relaxed);
+    out.missed_ticks += policy_->missed_ticks();
+    out.unchanged_skips += unchanged_skips_.load(std::memory_order_relaxed);
+    out.dedupe_suppressed += dedupe_suppressed_.load(std::memory_order_relaxed);
+    out.trailing_sends += trailing_sends_.load(std::memory_order_relaxed);
+    out.compressed_in_bytes += compressed_in_bytes_.load(std::memory_order_relaxed);
+    out.compressed_out_bytes += compressed_out_bytes_.load(std::memory_order_relaxed);
+    out.compress_errors += compress_errors_.load(std::memory_order_relaxed);
+    out.compress_ns += compress_ns_.load(std::memory_order_relaxed);
+    out.decompress_ns += decompress_ns_.load(std::memory_order_relaxed);
 }
 
 // Implementation of TransferAtomicPduGroup
 hakoniwa::pdu::bridge::TransferAtomicPduGroup::TransferAtomicPduGroup(
     const std::vector<hakoniwa::pdu::bridge::PduKey>& config_keys,
     std::shared_ptr<IPduTransferPolicy> policy,
-    std::shared_ptr<hakoniwa::time_source::ITimeSource> time_source,
-    std::shared_ptr<hakoniwa::pdu::Endpoint> src,
+    std::shared_ptr<CycleClock> clock,
+    std::shared_ptr<SourceSnapshot> src,
     std::shared_ptr<hakoniwa::pdu::Endpoint> dst)
     : policy_(policy),
-      time_source_(time_source),
-      src_endpoint_(src),
+      clock_(clock),
+      src_snapshot_(src),
+      src_endpoint_(src ? src->endpoint() : nullptr),
       dst_endpoint_(dst),
       is_active_(true),
       owner_epoch_(0)
 {
-    if (!src || !dst) {
+    if (!src_endpoint_ || !dst) {
         is_active_ = false;
         return;
     }
-    auto immediate_policy = std::dynamic_pointer_cast<ImmediatePolicy>(policy_);
+    immediate_policy_ = std::dynamic_pointer_cast<ImmediatePolicy>(policy_);
+    auto& keys = *src_snapshot_->keys();
+    members_.reserve(config_keys.size());
     for (const auto& key : config_keys) {
-            auto channel_id = src->get_pdu_channel_id({key.robot_name, key.pdu_name});
-            PduResolvedKey pdu_resolved_key{
-            .robot = key.robot_name,
-            .channel_id = channel_id
-        };
+        const hakoniwa::pdu::PduKey endpoint_key{key.robot_name, key.pdu_name};
+        Member member;
+        member.key_id = keys.intern_pdu(key.robot_name, key.pdu_name);
+        member.src_key = &keys.resolved_key(member.key_id.robot, src_endpoint_->get_pdu_channel_id(endpoint_key));
+        member.dst_key = &keys.resolved_key(member.key_id.robot, dst_endpoint_->get_pdu_channel_id(endpoint_key));
+        member.pdu_size = src_endpoint_->get_pdu_size(endpoint_key);
         #ifdef ENABLE_DEBUG_MESSAGES
         std::cout << "INFO: Registering atomic group PDU: "
-                  << " robot=" << pdu_resolved_key.robot
+                  << " robot=" << key.robot_name
                   << " pdu_name=" << key.pdu_name
-                  << " channel=" << pdu_resolved_key.channel_id
+                  << " channel=" << member.src_key->channel_id
                   << std::endl;
         #endif
-        transfer_atomic_pdu_group_.emplace_back(std::make_unique<hakoniwa::pdu::PduResolvedKey>(pdu_resolved_key));
-        if (immediate_policy) {
-            immediate_policy->add_pdu_key(pdu_resolved_key);
+        if (immediate_policy_) {
+            member.ready_slot = immediate_policy_->add_pdu_key(*member.src_key);
         }
-        src_endpoint_->subscribe_on_recv_callback(
-            pdu_resolved_key,
-            [this](const hakoniwa::pdu::PduResolvedKey& pdu_key, std::span<const std::byte> data) {
-                this->on_recv_callback(pdu_key, data);
+        member.slot = src_snapshot_->register_key(*member.src_key, member.pdu_size);
+        members_.push_back(std::move(member));
+    }
+    for (size_t i = 0; i < members_.size(); ++i) {
+        listener_ids_.push_back(src_snapshot_->add_listener(
+            members_[i].slot,
+            [this, i](const hakoniwa::pdu::PduResolvedKey& pdu_key, std::span<const std::byte> data) {
+                this->on_recv_callback(i, pdu_key, data);
             }
-        );
+        ));
+    }
+}
+
+hakoniwa::pdu::bridge::TransferAtomicPduGroup::~TransferAtomicPduGroup()
+{
+    if (src_snapshot_) {
+        for (auto id : listener_ids_) {
+            src_snapshot_->remove_listener(id);
+        }
     }
 }
 
@@ -213,28 +614,51 @@ void hakoniwa::pdu::bridge::TransferAtomicPduGroup::set_epoch(uint8_t epoch)
     owner_epoch_.store(epoch, std::memory_order_relaxed);
 }
 
-void hakoniwa::pdu::bridge::TransferAtomicPduGroup::cyclic_trigger()
+std::string hakoniwa::pdu::bridge::TransferAtomicPduGroup::label_(const Member& member) const
+{
+    return src_snapshot_->keys()->label(member.key_id);
+}
+
+void hakoniwa::pdu::bridge::TransferAtomicPduGroup::accumulate_counters(const PduKeyId& key, TransferCounters& out) const
+{
+    for (const auto& member : members_) {
+        if (member.key_id == key) {
+            // Stage counters are kept per group, not per member.
+            out.transfers += frames_sent_.load(std::memory_order_relaxed);
+            out.compressed_in_bytes += compressed_in_bytes_.load(std::memory_order_relaxed);
+            out.compressed_out_bytes += compressed_out_bytes_.load(std::memory_order_relaxed);
+            out.compress_errors += compress_errors_.load(std::memory_order_relaxed);
+            out.compress_ns += compress_ns_.load(std::memory_order_relaxed);
+            out.decompress_ns += decompress_ns_.load(std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+void hakoniwa::pdu::bridge::TransferAtomicPduGroup::cyclic_trigger(const CycleContext& /* ctx */)
 {
     // Event-driven only: cyclic_trigger is intentionally ignored.
 }
 
 void hakoniwa::pdu::bridge::TransferAtomicPduGroup::try_transfer(
-    const hakoniwa::pdu::PduResolvedKey& pdu_key, std::span<const std::byte> data)
+    size_t member_index, const hakoniwa::pdu::PduResolvedKey& pdu_key, std::span<const std::byte> data)
 {
     #ifdef ENABLE_DEBUG_MESSAGES
     std::cout << "INFO: TransferAtomicPduGroup try_transfer called for Robot: "
               << pdu_key.robot << " Channel ID: " << pdu_key.channel_id << std::endl;
     #endif
-    (void)pdu_key; // Not used in this context as we transfer the whole group
-    (void)data;    // Not used
     if (!is_active_) {
         //std::cerr << "INFO: TransferAtomicPduGroup is inactive. Skipping transfer." << std::endl;
         return;
     }
     // Event-driven policies gate transfers by should_transfer().
-    if (policy_->should_transfer(pdu_key, time_source_)) {
-        try_transfer_group();
-        policy_->on_transferred(pdu_key, time_source_);
+    const CycleContext ctx = clock_->event_context();
+    const bool ready = immediate_policy_
+        ? immediate_policy_->mark_ready(members_[member_index].ready_slot)
+        : policy_->should_transfer(pdu_key, ctx);
+    if (ready) {
+        try_transfer_group(ctx, member_index, data);
+        policy_->on_transferred(pdu_key, ctx);
     }
     else {
         #ifdef ENABLE_DEBUG_MESSAGES
@@ -244,87 +668,128 @@ void hakoniwa::pdu::bridge::TransferAtomicPduGroup::try_transfer(
     }
 }
 
-void hakoniwa::pdu::bridge::TransferAtomicPduGroup::try_transfer_group()
+void hakoniwa::pdu::bridge::TransferAtomicPduGroup::try_transfer_group(
+    const CycleContext& ctx, size_t trigger_index, std::span<const std::byte> trigger_data)
 {
     //std::cout << "DEBUG: START transfer" << std::endl;
-    struct PduBuffer {
-        hakoniwa::pdu::PduResolvedKey key;
-        std::string pdu_name;
-        std::vector<std::byte> data;
-    };
-    std::vector<PduBuffer> buffers;
-    buffers.reserve(transfer_atomic_pdu_group_.size());
-
-    for (auto& pdu_resolved_key : transfer_atomic_pdu_group_) {
+    bool complete = true;
+    for (size_t i = 0; i < members_.size(); ++i) {
+        auto& member = members_[i];
 #ifdef ENABLE_DEBUG_MESSAGES
         std::cout << "INFO: Bridge atomic group transfer triggered: "
                   << " src=" << src_endpoint_->get_name()
                   << " dst=" << dst_endpoint_->get_name()
-                  << " robot=" << pdu_resolved_key->robot
-                  << " channel=" << pdu_resolved_key->channel_id
+                  << " pdu=" << label_(member)
+                  << " channel=" << member.src_key->channel_id
                   << std::endl;
 #endif
         // Read PDU
-        std::string pdu_name = src_endpoint_->get_pdu_name(*pdu_resolved_key);
-        size_t pdu_size = src_endpoint_->get_pdu_size(
-            {pdu_resolved_key->robot, pdu_name}
-        );
-        if (pdu_size == 0) {
-            std::cerr << "ERROR: PDU size is 0 for " << pdu_resolved_key->robot 
-                      << "." << pdu_name << ". Skipping transfer." << std::endl;
+        if (member.pdu_size == 0) {
+            std::cerr << "ERROR: PDU size is 0 for " << label_(member) << ". Skipping transfer." << std::endl;
             continue;
         }
-        std::vector<std::byte> buffer(pdu_size); // Use std::byte for raw PDU data
         size_t received_size = 0;
-        // Read from source endpoint
-        HakoPduErrorType read_err = src_endpoint_->recv(
-            *pdu_resolved_key, std::span<std::byte>(buffer), received_size
-        );
-        if (read_err != HAKO_PDU_ERR_OK) {
-            std::cerr << "ERROR: Failed to read PDU " << pdu_resolved_key->robot 
-                      << "." << pdu_name << " from source: " << read_err << std::endl;
-            continue;
+        if (i == trigger_index && !trigger_data.empty()) {
+            // Zero-copy: forward the payload of the triggering event.
+            member.payload = trigger_data;
+            received_size = trigger_data.size();
         }
-        if (received_size != pdu_size) {
-             std::cerr << "WARNING: PDU " << pdu_resolved_key->robot 
-                      << "." << pdu_name << " read " << received_size 
-                      << " bytes, expected " << pdu_size << std::endl;
+        else {
+            // Read from the per-cycle source snapshot
+            HakoPduErrorType read_err = src_snapshot_->read(member.slot, member.staged, received_size);
+            if (read_err != HAKO_PDU_ERR_OK) {
+                std::cerr << "ERROR: Failed to read PDU " << label_(member) << " from source: " << read_err << std::endl;
+                member.staged.reset();
+                continue;
+            }
+            member.payload = std::span<const std::byte>(*member.staged);
+        }
+        if (decompress_) {
+            const auto start = std::chrono::steady_clock::now();
+            const bool ok = decompress_payload(member.payload, member.pdu_size, member.decompress_scratch, member.payload);
+            decompress_ns_.fetch_add(elapsed_ns(start), std::memory_order_relaxed);
+            if (!ok) {
+                std::cerr << "ERROR: Failed to decompress PDU " << label_(member) << std::endl;
+                member.staged.reset();
+                member.payload = {};
+                continue;
+            }
+            received_size = member.payload.size();
+        }
+        // Variable-length PDUs may arrive shorter than declared; only empty or
+        // oversized payloads are rejected.
+        if (received_size == 0 || received_size > member.pdu_size) {
+             std::cerr << "WARNING: PDU " << label_(member) << " read " << received_size 
+                      << " bytes, expected at most " << member.pdu_size << std::endl;
+            member.staged.reset();
+            member.payload = {};
             continue;
         }
 
         if (epoch_validation_) {
             uint8_t pdu_epoch = 0;
-            if (hako_pdu_get_epoch(buffer.data(), &pdu_epoch) != 0) {
+            if (hako_pdu_get_epoch(member.payload.data(), &pdu_epoch) != 0) {
                 std::cerr << "ERROR: Failed to get epoch from PDU "
-                          << pdu_resolved_key->robot << "." << pdu_name << std::endl;
-                return;
+                          << label_(member) << std::endl;
+                complete = false;
+                break;
             }
             if (pdu_epoch != owner_epoch_.load(std::memory_order_relaxed)) {
                 #ifdef ENABLE_DEBUG_MESSAGES
                 std::cout << "DEBUG: Discarding atomic group (epoch " << static_cast<int>(pdu_epoch)
                           << ", owner " << static_cast<int>(owner_epoch_.load(std::memory_order_relaxed)) << ")" << std::endl;
                 #endif
-                return;
+                complete = false;
+                break;
             }
         }
-        buffers.push_back(PduBuffer{*pdu_resolved_key, pdu_name, std::move(buffer)});
+    }
+    if (complete && budget_) {
+        size_t group_bytes = 0;
+        for (const auto& member : members_) {
+            group_bytes += member.payload.size();
+        }
+        complete = budget_->admit(ctx.now_usec, group_bytes, priority_, false) == BudgetDecision::Send;
     }
 
-    for (const auto& entry : buffers) {
+    for (auto& member : members_) {
+        if (member.payload.empty()) {
+            continue;
+        }
+        // Release the staged payload afterwards so the snapshot can refill it in place.
+        const std::span<const std::byte> data = member.payload;
+        PduBufferPtr staged = std::move(member.staged);
+        member.staged.reset();
+        member.payload = {};
+        if (!complete) {
+            continue;
+        }
+        std::span<const std::byte> wire = data;
+        if (compression_.algorithm != CompressionAlgorithm::None) {
+            const auto start = std::chrono::steady_clock::now();
+            const CompressResult result = compress_payload(compression_, data, member.compress_scratch, wire);
+            compress_ns_.fetch_add(elapsed_ns(start), std::memory_order_relaxed);
+            if (result == CompressResult::Failed) {
+                compress_errors_.fetch_add(1, std::memory_order_relaxed);
+                std::cerr << "ERROR: Failed to compress PDU " << label_(member) << "; sending it raw" << std::endl;
+            }
+            compressed_in_bytes_.fetch_add(data.size(), std::memory_order_relaxed);
+            compressed_out_bytes_.fetch_add(wire.size(), std::memory_order_relaxed);
+        }
         // write to destination endpoint
-        HakoPduErrorType write_err = dst_endpoint_->send(
-            entry.key, std::span<const std::byte>(entry.data)
-        );
+        HakoPduErrorType write_err = dst_endpoint_->send(*member.dst_key, wire);
         if (write_err != HAKO_PDU_ERR_OK) {
-            std::cerr << "ERROR: Failed to write PDU " << entry.key.robot
-                      << "." << entry.pdu_name << " to destination: " << write_err << std::endl;
+            std::cerr << "ERROR: Failed to write PDU " << label_(member) << " to destination: " << write_err << std::endl;
             continue;
         }
         dst_endpoint_->process_recv_events(); // Ensure the destination processes the received PDU
     }
+    if (complete) {
+        frames_sent_.fetch_add(1, std::memory_order_relaxed);
+    }
 #ifdef ENABLE_DEBUG_MESSAGES
     std::cout << "INFO: Bridge atomic group transfer completed: "
-              << " bytes=" << transfer_atomic_pdu_group_.size()
+              << " bytes=" << members_.size()
               << " src=" << src_endpoint_->get_name()
               << " dst=" << dst_endpoint_->get_name()
               << std::endl;
@@ -0,0 +1,78 @@
+#include "hakoniwa/pdu/bridge/transfer_scheduler.hpp"
+#include "hakoniwa/pdu/bridge/transfer_pdu.hpp"
+#include <algorithm>
+
+namespace hakoniwa::pdu::bridge {
+
+void TransferScheduler::sync(const std::vector<ScheduledTransfer>& transfers)
+{
+    // Both lists are ascending by seq, so one merge pass finds the changes.
+    removed_.clear();
+    size_t i = 0;
+    for (const auto& t : transfers) {
+        while (i < members_.size() && members_[i] < t.seq) {
+            removed_.push_back(members_[i++]);
+        }
+        if (i < members_.size() && members_[i] == t.seq) {
+            ++i;
+        }
+        else {
+            push_(t.transfer, t.seq);
+        }
+    }
+    removed_.insert(removed_.end(), members_.begin() + static_cast<std::ptrdiff_t>(i), members_.end());
+    if (!removed_.empty()) {
+        auto it = std::remove_if(heap_.begin(), heap_.end(),
+            [this](const Entry& e) { return std::binary_search(removed_.begin(), removed_.end(), e.seq); });
+        heap_.erase(it, heap_.end());
+        std::make_heap(heap_.begin(), heap_.end(), Later{});
+    }
+    members_.clear();
+    for (const auto& t : transfers) {
+        members_.push_back(t.seq);
+    }
+}
+
+void TransferScheduler::run_due(const CycleContext& ctx)
+{
+    due_.clear();
+    while (!heap_.empty() && heap_.front().deadline_usec <= ctx.now_usec) {
+        std::pop_heap(heap_.begin(), heap_.end(), Later{});
+        due_.push_back(heap_.back());
+        heap_.pop_back();
+    }
+    std::sort(due_.begin(), due_.end(),
+        [](const Entry& a, const Entry& b) {
+            if (a.priority != b.priority) {
+                return a.priority < b.priority;
+            }
+            return a.deadline_usec != b.deadline_usec ? a.deadline_usec < b.deadline_usec : a.seq < b.seq;
+        });
+    for (const auto& entry : due_) {
+        entry.transfer->cyclic_trigger(ctx);
+        push_(entry.transfer, entry.seq);
+    }
+}
+
+void TransferScheduler::resync()
+{
+    for (auto& entry : heap_) {
+        entry.deadline_usec = entry.transfer->next_deadline_usec();
+    }
+    auto it = std::remove_if(heap_.begin(), heap_.end(),
+        [](const Entry& e) { return e.deadline_usec == kNoDeadline; });
+    heap_.erase(it, heap_.end());
+    std::make_heap(heap_.begin(), heap_.end(), Later{});
+}
+
+void TransferScheduler::push_(ITransferPdu* transfer, uint64_t seq)
+{
+    const uint64_t deadline = transfer->next_deadline_usec();
+    if (deadline == kNoDeadline) {
+        return;
+    }
+    heap_.push_back(Entry{deadline, seq, transfer->priority(), transfer});
+    std::push_heap(heap_.begin(), heap_.end(), Later{});
+}
+
+} // namespace hakoniwa::pdu::bridge
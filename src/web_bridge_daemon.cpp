@@ -46,7 +46,6 @@ std::shared_ptr<hakoniwa::pdu::EndpointContainer> g_endpoint_container;
 std::shared_ptr<hakoniwa::pdu::bridge::BridgeCore> g_core;
 std::shared_ptr<hakoniwa::pdu::bridge::BridgeMonitorRuntime> g_monitor_runtime;
 std::shared_ptr<hakoniwa::time_source::ITimeSource> g_bridge_time_source;
-std::shared_ptr<hakoniwa::time_source::ITimeSource> g_real_sleep_time_source;
 
 void signal_handler(int signum)
 {
@@ -256,7 +255,6 @@ int bridge_on_initialize(hako_asset_context_t*)
 
     log_info("building bridge core");
     g_bridge_time_source = hakoniwa::time_source::create_time_source("hakoniwa_callback", g_options.delta_time_step_usec);
-    g_real_sleep_time_source = hakoniwa::time_source::create_time_source("real", g_options.delta_time_step_usec);
     auto build_result = hakoniwa::pdu::bridge::build(
         g_options.bridge_config_path,
         g_options.node_name,
@@ -308,8 +306,9 @@ int bridge_on_simulation_step(hako_asset_context_t*)
         log_info("bridge core is not running");
         return 0;
     }
-    if (g_options.enable_real_sleep && g_real_sleep_time_source) {
-        g_real_sleep_time_source->sleep_delta_time();
+    if (g_options.enable_real_sleep) {
+        // Absolute deadlines: the step's own processing time is not added.
+        g_core->sleep_until_next_period();
     }
     return 0;
 }
@@ -327,7 +326,6 @@ int bridge_on_reset(hako_asset_context_t*)
     g_core.reset();
     g_monitor_runtime.reset();
     g_bridge_time_source.reset();
-    g_real_sleep_time_source.reset();
     g_endpoint_container.reset();
     return 0;
 }
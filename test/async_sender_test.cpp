@@ -0,0 +1,85 @@
+#include "hakoniwa/pdu/bridge/async_sender.hpp"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge::test {
+
+TEST(AsyncSenderTest, ParsesOverflowPolicyNames)
+{
+    EXPECT_EQ(parse_async_overflow_policy("dropOldest"), AsyncOverflowPolicy::DropOldest);
+    EXPECT_EQ(parse_async_overflow_policy("dropNewest"), AsyncOverflowPolicy::DropNewest);
+    EXPECT_EQ(parse_async_overflow_policy("block"), AsyncOverflowPolicy::Block);
+    EXPECT_FALSE(parse_async_overflow_policy("drop_oldest").has_value());
+}
+
+TEST(AsyncSenderTest, RingIsBoundedAndFifo)
+{
+    BoundedRing<int> ring(3);
+    ASSERT_EQ(ring.capacity(), 4u);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.try_push([i](int& slot) { slot = i; }));
+    }
+    EXPECT_FALSE(ring.try_push([](int& slot) { slot = 99; }));
+    EXPECT_EQ(ring.size(), 4u);
+
+    // Dropping the oldest makes room for the newest.
+    EXPECT_TRUE(ring.try_pop([](int&) {}));
+    EXPECT_TRUE(ring.try_push([](int& slot) { slot = 4; }));
+
+    std::vector<int> out;
+    while (ring.try_pop([&out](int& slot) { out.push_back(slot); })) {
+    }
+    EXPECT_EQ(out, (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(ring.size(), 0u);
+}
+
+TEST(AsyncSenderTest, RingKeepsEveryItemUnderConcurrentProducers)
+{
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 20000;
+    BoundedRing<uint64_t> ring(64);
+    std::atomic<bool> done{false};
+    std::vector<int> next_expected(kProducers, 0);
+    bool in_order = true;
+    uint64_t received = 0;
+
+    std::thread consumer([&]() {
+        auto take = [&](uint64_t& value) {
+            const int producer = static_cast<int>(value >> 32);
+            const int index = static_cast<int>(value & 0xffffffffu);
+            in_order = in_order && index == next_expected[producer];
+            next_expected[producer] = index + 1;
+            ++received;
+        };
+        while (!done.load() || ring.size() > 0) {
+            if (!ring.try_pop(take)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&ring, p]() {
+            for (int i = 0; i < kPerProducer; ++i) {
+                const uint64_t value = (static_cast<uint64_t>(p) << 32) | static_cast<uint32_t>(i);
+                while (!ring.try_push([value](uint64_t& slot) { slot = value; })) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+    done.store(true);
+    consumer.join();
+
+    EXPECT_EQ(received, static_cast<uint64_t>(kProducers) * kPerProducer);
+    EXPECT_TRUE(in_order); // each producer's items stay in order
+}
+
+} // namespace hakoniwa::pdu::bridge::test
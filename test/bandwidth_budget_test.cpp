@@ -0,0 +1,48 @@
+#include "hakoniwa/pdu/bridge/bandwidth_budget.hpp"
+#include <gtest/gtest.h>
+
+namespace hakoniwa::pdu::bridge::test {
+
+TEST(BandwidthBudgetTest, ParsesPriorityNames)
+{
+    EXPECT_EQ(parse_transfer_priority("high"), TransferPriority::High);
+    EXPECT_EQ(parse_transfer_priority("normal"), TransferPriority::Normal);
+    EXPECT_EQ(parse_transfer_priority("low"), TransferPriority::Low);
+    EXPECT_FALSE(parse_transfer_priority("urgent").has_value());
+}
+
+TEST(BandwidthBudgetTest, HoldsBackLowerClassesOnceExhausted)
+{
+    // 1000 B/s with a 100 byte burst.
+    BandwidthBudget budget(1000, 100);
+    EXPECT_EQ(budget.admit(0, 60, TransferPriority::Normal, true), BudgetDecision::Send);
+    EXPECT_EQ(budget.admit(0, 60, TransferPriority::Normal, true), BudgetDecision::Defer);
+    EXPECT_EQ(budget.admit(0, 60, TransferPriority::Normal, false), BudgetDecision::Drop);
+    EXPECT_EQ(budget.admit(0, 30, TransferPriority::Low, true), BudgetDecision::Send);
+    EXPECT_EQ(budget.admit(0, 30, TransferPriority::Low, true), BudgetDecision::Drop);
+    // High always goes out, overdrawing by at most one burst.
+    EXPECT_EQ(budget.admit(0, 500, TransferPriority::High, true), BudgetDecision::Send);
+
+    // Debt of 100 bytes: 100 ms to reach zero, another 50 ms for 50 bytes.
+    EXPECT_EQ(budget.admit(140000, 50, TransferPriority::Normal, true), BudgetDecision::Defer);
+    EXPECT_EQ(budget.admit(150000, 50, TransferPriority::Normal, true), BudgetDecision::Send);
+
+    const BudgetStats stats = budget.stats();
+    EXPECT_EQ(stats.bytes_per_sec, 1000u);
+    EXPECT_EQ(stats.sent_bytes, 60u + 30u + 500u + 50u);
+    EXPECT_EQ(stats.allowance_bytes, 100u + 150u);
+    EXPECT_EQ(stats.deferred, 2u);
+    EXPECT_EQ(stats.dropped, 2u);
+}
+
+TEST(BandwidthBudgetTest, IdleRefillIsCappedAtBurst)
+{
+    BandwidthBudget budget(1000, 100);
+    EXPECT_EQ(budget.admit(0, 100, TransferPriority::Normal, true), BudgetDecision::Send);
+    // Hours of idle time only refill one burst.
+    const uint64_t later = 10ull * 3600 * 1000 * 1000;
+    EXPECT_EQ(budget.admit(later, 100, TransferPriority::Normal, true), BudgetDecision::Send);
+    EXPECT_EQ(budget.admit(later, 1, TransferPriority::Normal, true), BudgetDecision::Defer);
+}
+
+} // namespace hakoniwa::pdu::bridge::test
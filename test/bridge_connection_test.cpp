@@ -2,8 +2,10 @@
 #include "hakoniwa/pdu/bridge/transfer_pdu.hpp"
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <thread>
 
 namespace hakoniwa::pdu::bridge::test {
 
@@ -11,7 +13,7 @@ namespace {
 
 class DummyTransferPdu final : public ITransferPdu {
 public:
-    void cyclic_trigger() override { ++cyclic_count_; }
+    void cyclic_trigger(const CycleContext&) override { ++cyclic_count_; }
     void set_active(bool is_active) override { is_active_ = is_active; }
     void set_epoch(uint8_t epoch) override { last_epoch_ = epoch; }
     void set_epoch_validation(bool enable) override { epoch_validation_ = enable; }
@@ -28,6 +30,50 @@ private:
     bool epoch_validation_ = false;
 };
 
+// Cyclic transfer that becomes due every interval_usec, like a ticker.
+class DeadlineTransferPdu final : public ITransferPdu {
+public:
+    explicit DeadlineTransferPdu(uint64_t interval_usec) : interval_usec_(interval_usec) {}
+
+    void cyclic_trigger(const CycleContext& ctx) override
+    {
+        ++cyclic_count_;
+        next_deadline_usec_ = ctx.now_usec + interval_usec_;
+    }
+    uint64_t next_deadline_usec() const override { return next_deadline_usec_; }
+    void set_active(bool) override {}
+    void set_epoch(uint8_t) override {}
+    void set_epoch_validation(bool) override {}
+
+    int cyclic_count() const { return cyclic_count_; }
+
+private:
+    uint64_t interval_usec_;
+    uint64_t next_deadline_usec_ = 0;
+    int cyclic_count_ = 0;
+};
+
+class EventOnlyTransferPdu final : public ITransferPdu {
+public:
+    void cyclic_trigger(const CycleContext&) override { ++cyclic_count_; }
+    uint64_t next_deadline_usec() const override { return kNoDeadline; }
+    void set_active(bool) override {}
+    void set_epoch(uint8_t) override {}
+    void set_epoch_validation(bool) override {}
+
+    int cyclic_count() const { return cyclic_count_; }
+
+private:
+    int cyclic_count_ = 0;
+};
+
+CycleContext at(uint64_t now_usec)
+{
+    CycleContext ctx;
+    ctx.now_usec = now_usec;
+    return ctx;
+}
+
 } // namespace
 
 TEST(BridgeConnectionTest, PauseResumeDisablesTransferPdus) {
@@ -44,7 +90,7 @@ TEST(BridgeConnectionTest, PauseResumeDisablesTransferPdus) {
     EXPECT_TRUE(pdu1_raw->epoch_validation());
     EXPECT_TRUE(pdu2_raw->epoch_validation());
 
-    connection.cyclic_trigger();
+    connection.cyclic_trigger(CycleContext{});
     EXPECT_EQ(pdu1_raw->cyclic_count(), 1);
     EXPECT_EQ(pdu2_raw->cyclic_count(), 1);
 
@@ -52,7 +98,7 @@ TEST(BridgeConnectionTest, PauseResumeDisablesTransferPdus) {
     EXPECT_FALSE(pdu1_raw->is_active());
     EXPECT_FALSE(pdu2_raw->is_active());
 
-    connection.cyclic_trigger();
+    connection.cyclic_trigger(CycleContext{});
     EXPECT_EQ(pdu1_raw->cyclic_count(), 1);
     EXPECT_EQ(pdu2_raw->cyclic_count(), 1);
 
@@ -60,9 +106,77 @@ TEST(BridgeConnectionTest, PauseResumeDisablesTransferPdus) {
     EXPECT_TRUE(pdu1_raw->is_active());
     EXPECT_TRUE(pdu2_raw->is_active());
 
-    connection.cyclic_trigger();
+    connection.cyclic_trigger(CycleContext{});
     EXPECT_EQ(pdu1_raw->cyclic_count(), 2);
     EXPECT_EQ(pdu2_raw->cyclic_count(), 2);
 }
 
+TEST(BridgeConnectionTest, CyclicTriggerOnlyRunsDueTransfers) {
+    BridgeConnection connection("node1", "conn1", false, nullptr);
+
+    auto fast = std::make_unique<DeadlineTransferPdu>(1000);
+    auto slow = std::make_unique<DeadlineTransferPdu>(5000);
+    auto event_only = std::make_unique<EventOnlyTransferPdu>();
+    DeadlineTransferPdu* fast_raw = fast.get();
+    DeadlineTransferPdu* slow_raw = slow.get();
+    EventOnlyTransferPdu* event_only_raw = event_only.get();
+    connection.add_transfer_pdu(std::move(fast));
+    connection.add_transfer_pdu(std::move(slow));
+    connection.add_transfer_pdu(std::move(event_only));
+
+    // Newly added transfers are due immediately.
+    EXPECT_EQ(connection.next_deadline_usec(), 0u);
+    connection.cyclic_trigger(at(0));
+    EXPECT_EQ(fast_raw->cyclic_count(), 1);
+    EXPECT_EQ(slow_raw->cyclic_count(), 1);
+    EXPECT_EQ(connection.next_deadline_usec(), 1000u);
+
+    connection.cyclic_trigger(at(500));
+    EXPECT_EQ(fast_raw->cyclic_count(), 1);
+    EXPECT_EQ(slow_raw->cyclic_count(), 1);
+
+    for (uint64_t now = 1000; now <= 5000; now += 1000) {
+        connection.cyclic_trigger(at(now));
+    }
+    EXPECT_EQ(fast_raw->cyclic_count(), 6);
+    EXPECT_EQ(slow_raw->cyclic_count(), 2);
+    EXPECT_EQ(event_only_raw->cyclic_count(), 0);
+    EXPECT_EQ(connection.next_deadline_usec(), 6000u);
+
+    connection.set_active(false);
+    EXPECT_EQ(connection.next_deadline_usec(), kNoDeadline);
+    connection.set_active(true);
+
+    EXPECT_TRUE(connection.remove_transfer_pdu(fast_raw));
+    EXPECT_EQ(connection.next_deadline_usec(), 10000u);
+}
+
+TEST(BridgeConnectionTest, TransferChurnRunsAlongsideCyclicTrigger) {
+    BridgeConnection connection("node1", "conn1", false, nullptr);
+    auto base = std::make_unique<DeadlineTransferPdu>(1000);
+    DeadlineTransferPdu* base_raw = base.get();
+    connection.add_transfer_pdu(std::move(base));
+
+    // Monitor attach/detach from another thread while cycles keep running.
+    std::atomic<bool> done{false};
+    std::thread churn([&]() {
+        while (!done.load()) {
+            ITransferPdu* monitor = connection.add_monitor_transfer_pdu(std::make_unique<DeadlineTransferPdu>(1000));
+            connection.increment_epoch();
+            EXPECT_TRUE(connection.remove_transfer_pdu(monitor));
+        }
+    });
+    for (uint64_t now = 0; now < 2000 * 1000; now += 1000) {
+        connection.cyclic_trigger(at(now));
+    }
+    done.store(true);
+    churn.join();
+
+    EXPECT_EQ(base_raw->cyclic_count(), 2000);
+    // Nothing is pinned any more, so the next write frees every leftover.
+    connection.remove_transfer_pdu(base_raw);
+    EXPECT_EQ(connection.pending_reclaim(), 0u);
+    EXPECT_EQ(connection.next_deadline_usec(), kNoDeadline);
+}
+
 } // namespace hakoniwa::pdu::bridge::test
@@ -15,7 +15,9 @@
 #include <vector>
 #include <cstddef>
 #include <atomic>
+#include <chrono>
 #include <optional>
+#include <thread>
 
 namespace hakoniwa::pdu::bridge::test {
 
@@ -85,6 +87,9 @@ TEST(BridgeCoreFlowTest, ImmediatePolicyFlow) {
 
     ASSERT_EQ(received_size, pdu_size);
     ASSERT_EQ(send_pdu, recv_pdu);
+
+    // Immediate transfers forward the callback payload; the source is never re-read.
+    EXPECT_EQ(bridge_core->source_snapshot(src_ep)->endpoint_read_count(), 0U);
 }
 
 TEST(BridgeCoreFlowTest, AtomicPolicyFlow) {
@@ -294,6 +299,56 @@ TEST(BridgeCoreFlowTest, PolicyInstanceIsIndependent) {
     EXPECT_EQ(recv_buffer, next_pdu_data);
 }
 
+TEST(BridgeCoreFlowTest, WorkerPoolRunsEveryConnectionWithinTheCycle) {
+    auto policy_sharing_config = [](const std::string& filename) {
+        return config_path(filename, "policy_sharing");
+    };
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
+        std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", policy_sharing_config("endpoints.json"));
+    ASSERT_EQ(endpoint_container->initialize(), HAKO_PDU_ERR_OK) << endpoint_container->last_error();
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+
+    auto result = hakoniwa::pdu::bridge::build(policy_sharing_config("bridge.json"), "node1", time_source, endpoint_container);
+    ASSERT_TRUE(result.ok()) << result.error_message;
+    auto bridge_core = std::move(result.core);
+    bridge_core->set_worker_pool({2, {}});
+    ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
+    bridge_core->start();
+
+    auto src1_ep = endpoint_container->ref("src1");
+    auto dst1_ep = endpoint_container->ref("dst1");
+    auto src2_ep = endpoint_container->ref("src2");
+    auto dst2_ep = endpoint_container->ref("dst2");
+    hakoniwa::pdu::PduKey key1 = {"TestRobot", "pdu1"};
+    hakoniwa::pdu::PduKey key2 = {"TestRobot", "pdu2"};
+    std::vector<std::byte> recv_buffer(16);
+    size_t received_size = 0;
+
+    time_source->advance_time(10000);
+    bridge_core->cyclic_trigger(); // prime the tickers
+    for (int i = 0; i < 5; ++i) {
+        std::vector<std::byte> pdu_data(16, std::byte(0x10 + i));
+        ASSERT_EQ(src1_ep->send(key1, pdu_data), HAKO_PDU_ERR_OK);
+        ASSERT_EQ(src2_ep->send(key2, pdu_data), HAKO_PDU_ERR_OK);
+        time_source->advance_time(10000);
+        ASSERT_TRUE(bridge_core->cyclic_trigger());
+        // Both connections have written once cyclic_trigger() returns.
+        recv_buffer.assign(16, std::byte{0});
+        ASSERT_EQ(dst1_ep->recv(key1, recv_buffer, received_size), HAKO_PDU_ERR_OK);
+        recv_buffer.resize(received_size);
+        EXPECT_EQ(recv_buffer, pdu_data);
+        recv_buffer.assign(16, std::byte{0});
+        ASSERT_EQ(dst2_ep->recv(key2, recv_buffer, received_size), HAKO_PDU_ERR_OK);
+        recv_buffer.resize(received_size);
+        EXPECT_EQ(recv_buffer, pdu_data);
+    }
+    const auto stats = bridge_core->worker_pool_stats();
+    EXPECT_EQ(stats.threads, 2U);
+    EXPECT_EQ(stats.runs, 6U);
+    EXPECT_EQ(stats.tasks, 12U);
+}
+
 TEST(BridgeCoreFlowTest, PolicyInstanceIsIndependentWithinSingleConnection) {
     auto policy_fanout_config = [](const std::string& filename) {
         return config_path(filename, "policy_fanout");
@@ -339,6 +394,441 @@ TEST(BridgeCoreFlowTest, PolicyInstanceIsIndependentWithinSingleConnection) {
     EXPECT_EQ(dst1_ep->recv(key2, recv_buffer, received_size), HAKO_PDU_ERR_OK);
 }
 
+TEST(BridgeCoreFlowTest, QueueSourceIsReadOncePerCycleForAllDestinations) {
+    auto source_snapshot_config = [](const std::string& filename) {
+        return config_path(filename, "source_snapshot");
+    };
+
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
+        std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", source_snapshot_config("endpoints.json"));
+    HakoPduErrorType init_ret = endpoint_container->initialize();
+    ASSERT_EQ(init_ret, HAKO_PDU_ERR_OK) << endpoint_container->last_error();
+
+    std::shared_ptr<hakoniwa::time_source::ITimeSource> itime_source =
+        hakoniwa::time_source::create_time_source("virtual", 0);
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(itime_source);
+
+    auto result = hakoniwa::pdu::bridge::build(source_snapshot_config("bridge.json"), "node1", time_source, endpoint_container);
+    ASSERT_TRUE(result.ok()) << result.error_message;
+    auto bridge_core = std::move(result.core);
+
+    ASSERT_TRUE(bridge_core != nullptr);
+    ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
+    bridge_core->start();
+
+    auto src1_ep = endpoint_container->ref("src1");
+    auto dst1_ep = endpoint_container->ref("dst1");
+    auto dst2_ep = endpoint_container->ref("dst2");
+    auto snapshot = bridge_core->source_snapshot(src1_ep);
+    ASSERT_TRUE(snapshot != nullptr);
+
+    // Prime ticker policy (first check initializes schedule).
+    time_source->advance_time(10000);
+    bridge_core->cyclic_trigger();
+
+    // The source is a queue: a second recv in the same cycle would pop nothing,
+    // so both destinations only get the value if it is read once and shared.
+    hakoniwa::pdu::PduKey key1 = {"TestRobot", "pdu1"};
+    std::vector<std::byte> pdu_data(16, std::byte(0x5A));
+    ASSERT_EQ(src1_ep->send(key1, pdu_data), HAKO_PDU_ERR_OK);
+
+    const uint64_t reads_before = snapshot->endpoint_read_count();
+    time_source->advance_time(10000);
+    bridge_core->cyclic_trigger();
+    EXPECT_EQ(snapshot->endpoint_read_count() - reads_before, 1U);
+
+    std::vector<std::byte> recv_buffer(16);
+    size_t received_size = 0;
+    ASSERT_EQ(dst1_ep->recv(key1, recv_buffer, received_size), HAKO_PDU_ERR_OK);
+    recv_buffer.resize(received_size);
+    EXPECT_EQ(recv_buffer, pdu_data);
+
+    recv_buffer.assign(16, std::byte(0));
+    received_size = 0;
+    ASSERT_EQ(dst2_ep->recv(key1, recv_buffer, received_size), HAKO_PDU_ERR_OK);
+    recv_buffer.resize(received_size);
+    EXPECT_EQ(recv_buffer, pdu_data);
+}
+
+TEST(BridgeCoreFlowTest, OnlyIfUpdatedTickerSkipsUnchangedSource) {
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
+        std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", config_path("endpoints.json"));
+    ASSERT_EQ(endpoint_container->initialize(), HAKO_PDU_ERR_OK) << endpoint_container->last_error();
+
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+    auto result = hakoniwa::pdu::bridge::build(
+        config_path("bridge-core-flow-ticker-updated-test.json"), "node1", time_source, endpoint_container);
+    ASSERT_TRUE(result.ok()) << result.error_message;
+    auto bridge_core = std::move(result.core);
+    ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
+    bridge_core->start();
+
+    auto src_ep = endpoint_container->ref("n1-epSrc");
+    hakoniwa::pdu::PduKey key = {"Drone", "pos"};
+    std::vector<std::byte> pdu_data(src_ep->get_pdu_size(key), std::byte(0x11));
+
+    // Prime the ticker, then publish once and let five ticks pass.
+    time_source->advance_time(10000);
+    bridge_core->cyclic_trigger();
+    ASSERT_EQ(src_ep->send(key, pdu_data), HAKO_PDU_ERR_OK);
+    for (int i = 0; i < 5; ++i) {
+        time_source->advance_time(10000);
+        bridge_core->cyclic_trigger();
+    }
+
+    auto pdus = bridge_core->list_pdus("conn1");
+    ASSERT_TRUE(pdus.has_value());
+    ASSERT_EQ(pdus->size(), 1U);
+    EXPECT_EQ(pdus->front().transfers.value_or(0), 1U);
+    EXPECT_EQ(pdus->front().unchanged_skips.value_or(0), 4U);
+
+    // A new publication is sent on the next tick.
+    ASSERT_EQ(src_ep->send(key, pdu_data), HAKO_PDU_ERR_OK);
+    time_source->advance_time(10000);
+    bridge_core->cyclic_trigger();
+    pdus = bridge_core->list_pdus("conn1");
+    ASSERT_TRUE(pdus.has_value());
+    EXPECT_EQ(pdus->front().transfers.value_or(0), 2U);
+}
+
+TEST(BridgeCoreFlowTest, DedupeSuppressesIdenticalPayloads) {
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
+        std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", config_path("endpoints.json"));
+    ASSERT_EQ(endpoint_container->initialize(), HAKO_PDU_ERR_OK) << endpoint_container->last_error();
+
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+    auto result = hakoniwa::pdu::bridge::build(
+        config_path("bridge-core-flow-dedupe-test.json"), "node1", time_source, endpoint_container);
+    ASSERT_TRUE(result.ok()) << result.error_message;
+    auto bridge_core = std::move(result.core);
+    ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
+    bridge_core->start();
+
+    auto src_ep = endpoint_container->ref("n1-epSrc");
+    hakoniwa::pdu::PduKey key = {"Drone", "pos"};
+    std::vector<std::byte> pdu_data(src_ep->get_pdu_size(key), std::byte(0x22));
+
+    auto counters = [&]() {
+        auto pdus = bridge_core->list_pdus("conn1");
+        EXPECT_TRUE(pdus.has_value() && pdus->size() == 1U);
+        return pdus->front();
+    };
+
+    // The same bytes three times within the refresh interval: one send.
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(src_ep->send(key, pdu_data), HAKO_PDU_ERR_OK);
+        time_source->advance_time(10000);
+    }
+    EXPECT_EQ(counters().transfers.value_or(0), 1U);
+    EXPECT_EQ(counters().dedupe_suppressed.value_or(0), 2U);
+
+    // Changed bytes are sent immediately.
+    pdu_data[0] = std::byte(0x23);
+    ASSERT_EQ(src_ep->send(key, pdu_data), HAKO_PDU_ERR_OK);
+    EXPECT_EQ(counters().transfers.value_or(0), 2U);
+
+    // Unchanged bytes are resent once dedupeRefreshMs has elapsed.
+    time_source->advance_time(100000);
+    ASSERT_EQ(src_ep->send(key, pdu_data), HAKO_PDU_ERR_OK);
+    EXPECT_EQ(counters().transfers.value_or(0), 3U);
+    EXPECT_EQ(counters().dedupe_suppressed.value_or(0), 2U);
+}
+
+TEST(BridgeCoreFlowTest, DedupeResendsPayloadEvictedFromAsyncQueue) {
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
+        std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", config_path("endpoints.json"));
+    ASSERT_EQ(endpoint_container->initialize(), HAKO_PDU_ERR_OK) << endpoint_container->last_error();
+
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+    auto result = hakoniwa::pdu::bridge::build(
+        config_path("bridge-core-flow-async-dedupe-test.json"), "node1", time_source, endpoint_container);
+    ASSERT_TRUE(result.ok()) << result.error_message;
+    auto bridge_core = std::move(result.core);
+    ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
+    bridge_core->start();
+
+    auto src_ep = endpoint_container->ref("n1-epSrc");
+    auto dst_ep = endpoint_container->ref("n1-epDst");
+    std::string error;
+    auto sender = bridge_core->async_sender(dst_ep, AsyncSendSettings{2, AsyncOverflowPolicy::DropOldest}, error);
+    ASSERT_TRUE(sender) << error;
+
+    hakoniwa::pdu::PduKey pos = {"Drone", "pos"};
+    hakoniwa::pdu::PduKey motor = {"Drone", "motor"};
+    std::vector<std::byte> pos_data(src_ep->get_pdu_size(pos), std::byte(0x31));
+    std::vector<std::byte> motor_data(src_ep->get_pdu_size(motor), std::byte(0x41));
+    auto wait_sent = [&](uint64_t expected) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (sender->stats().sent < expected && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        EXPECT_EQ(sender->stats().sent, expected);
+    };
+    auto dedupe_suppressed = [&]() {
+        uint64_t total = 0;
+        for (const auto& pdu : bridge_core->list_pdus("conn1").value_or(std::vector<PduStateDto>{})) {
+            total += pdu.dedupe_suppressed.value_or(0);
+        }
+        return total;
+    };
+
+    // With the sender held, two motor values push the queued pos value out.
+    sender->pause();
+    ASSERT_EQ(src_ep->send(pos, pos_data), HAKO_PDU_ERR_OK);
+    ASSERT_EQ(src_ep->send(motor, motor_data), HAKO_PDU_ERR_OK);
+    motor_data[0] = std::byte(0x42);
+    ASSERT_EQ(src_ep->send(motor, motor_data), HAKO_PDU_ERR_OK);
+    EXPECT_EQ(sender->stats().dropped, 1U);
+    sender->resume();
+    wait_sent(2);
+
+    // The same pos bytes again: never delivered, so not a duplicate.
+    ASSERT_EQ(src_ep->send(pos, pos_data), HAKO_PDU_ERR_OK);
+    EXPECT_EQ(dedupe_suppressed(), 0U);
+    wait_sent(3);
+    std::vector<std::byte> recv_pdu(pos_data.size());
+    size_t received_size = 0;
+    ASSERT_EQ(dst_ep->recv(pos, recv_pdu, received_size), HAKO_PDU_ERR_OK);
+    EXPECT_EQ(recv_pdu, pos_data);
+
+    // Once delivered, it is suppressed as before.
+    ASSERT_EQ(src_ep->send(pos, pos_data), HAKO_PDU_ERR_OK);
+    EXPECT_EQ(dedupe_suppressed(), 1U);
+}
+
+TEST(BridgeCoreFlowTest, AsyncEvictionCongestsAndOnlyAProbeRecovers) {
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
+        std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", config_path("endpoints.json"));
+    ASSERT_EQ(endpoint_container->initialize(), HAKO_PDU_ERR_OK) << endpoint_container->last_error();
+
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+    auto result = hakoniwa::pdu::bridge::build(
+        config_path("bridge-core-flow-async-backpressure-test.json"), "node1", time_source, endpoint_container);
+    ASSERT_TRUE(result.ok()) << result.error_message;
+    auto bridge_core = std::move(result.core);
+    ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
+    bridge_core->start();
+
+    auto src_ep = endpoint_container->ref("n1-epSrc");
+    auto dst_ep = endpoint_container->ref("n1-epDst");
+    std::string error;
+    auto sender = bridge_core->async_sender(dst_ep, AsyncSendSettings{2, AsyncOverflowPolicy::DropOldest}, error);
+    ASSERT_TRUE(sender) << error;
+
+    hakoniwa::pdu::PduKey pos = {"Drone", "pos"};
+    hakoniwa::pdu::PduKey motor = {"Drone", "motor"};
+    std::vector<std::byte> pos_data(src_ep->get_pdu_size(pos), std::byte(0x31));
+    std::vector<std::byte> motor_data(src_ep->get_pdu_size(motor), std::byte(0x41));
+    auto wait_sent = [&](uint64_t expected) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (sender->stats().sent < expected && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        EXPECT_EQ(sender->stats().sent, expected);
+    };
+    auto destination = [&]() {
+        auto connections = bridge_core->list_connections();
+        EXPECT_TRUE(connections.size() == 1U && connections.front().destinations.size() == 1U);
+        return connections.front().destinations.front();
+    };
+
+    // The enqueues succeed; the eviction they cause is the failed send.
+    sender->pause();
+    ASSERT_EQ(src_ep->send(pos, pos_data), HAKO_PDU_ERR_OK);
+    ASSERT_EQ(src_ep->send(motor, motor_data), HAKO_PDU_ERR_OK);
+    EXPECT_FALSE(destination().congested);
+    ASSERT_EQ(src_ep->send(motor, motor_data), HAKO_PDU_ERR_OK);
+    EXPECT_TRUE(destination().congested);
+    EXPECT_EQ(destination().congestion_events, 1U);
+
+    // Payloads queued before the congestion go out but prove nothing.
+    sender->resume();
+    wait_sent(2);
+    EXPECT_TRUE(destination().congested);
+
+    // The next probe is sent by the sender thread and clears it.
+    time_source->advance_time(100000);
+    ASSERT_EQ(src_ep->send(pos, pos_data), HAKO_PDU_ERR_OK);
+    wait_sent(3);
+    EXPECT_FALSE(destination().congested);
+    EXPECT_EQ(destination().recoveries, 1U);
+}
+
+TEST(BridgeCoreFlowTest, TrailingThrottleSendsNewestValueWhenWindowCloses) {
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
+        std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", config_path("endpoints.json"));
+    ASSERT_EQ(endpoint_container->initialize(), HAKO_PDU_ERR_OK) << endpoint_container->last_error();
+
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+    auto result = hakoniwa::pdu::bridge::build(
+        config_path("bridge-core-flow-trailing-test.json"), "node1", time_source, endpoint_container);
+    ASSERT_TRUE(result.ok()) << result.error_message;
+    auto bridge_core = std::move(result.core);
+    ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
+    bridge_core->start();
+
+    auto src_ep = endpoint_container->ref("n1-epSrc");
+    auto dst_ep = endpoint_container->ref("n1-epDst");
+    hakoniwa::pdu::PduKey key = {"Drone", "pos"};
+    const size_t pdu_size = src_ep->get_pdu_size(key);
+
+    auto counters = [&]() {
+        auto pdus = bridge_core->list_pdus("conn1");
+        EXPECT_TRUE(pdus.has_value() && pdus->size() == 1U);
+        return pdus->front();
+    };
+    auto publish = [&](uint8_t value) {
+        std::vector<std::byte> pdu_data(pdu_size, std::byte(value));
+        ASSERT_EQ(src_ep->send(key, pdu_data), HAKO_PDU_ERR_OK);
+    };
+    auto received = [&]() {
+        std::vector<std::byte> recv_pdu(pdu_size);
+        size_t received_size = 0;
+        EXPECT_EQ(dst_ep->recv(key, recv_pdu, received_size), HAKO_PDU_ERR_OK);
+        return recv_pdu.front();
+    };
+
+    // Leading edge: the first event of a burst goes out at once.
+    publish(0x01);
+    EXPECT_EQ(counters().transfers.value_or(0), 1U);
+    EXPECT_EQ(received(), std::byte(0x01));
+
+    // The rest of the burst falls inside the 50 ms window and is held back.
+    for (uint8_t value = 0x02; value <= 0x04; ++value) {
+        time_source->advance_time(10000);
+        publish(value);
+        bridge_core->cyclic_trigger();
+    }
+    EXPECT_EQ(counters().transfers.value_or(0), 1U);
+    EXPECT_EQ(received(), std::byte(0x01));
+
+    // Trailing edge: the newest value is sent when the window closes, once.
+    time_source->advance_time(20000);
+    bridge_core->cyclic_trigger();
+    EXPECT_EQ(counters().transfers.value_or(0), 2U);
+    EXPECT_EQ(counters().trailing_sends.value_or(0), 1U);
+    EXPECT_EQ(received(), std::byte(0x04));
+    for (int i = 0; i < 10; ++i) {
+        time_source->advance_time(10000);
+        bridge_core->cyclic_trigger();
+    }
+    EXPECT_EQ(counters().transfers.value_or(0), 2U);
+
+    // An event after a quiet spell is a new leading edge.
+    publish(0x05);
+    EXPECT_EQ(counters().transfers.value_or(0), 3U);
+    EXPECT_EQ(counters().trailing_sends.value_or(0), 1U);
+}
+
+TEST(BridgeCoreFlowTest, TrailingThrottleFlushesAtWindowEndAfterIdleCheck) {
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
+        std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", config_path("endpoints.json"));
+    ASSERT_EQ(endpoint_container->initialize(), HAKO_PDU_ERR_OK) << endpoint_container->last_error();
+
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+    auto result = hakoniwa::pdu::bridge::build(
+        config_path("bridge-core-flow-trailing-test.json"), "node1", time_source, endpoint_container);
+    ASSERT_TRUE(result.ok()) << result.error_message;
+    auto bridge_core = std::move(result.core);
+    // The source delivers its events itself; only the transfer's deadline counts.
+    ASSERT_TRUE(bridge_core->set_endpoint_polling("n1-epSrc", EndpointPolling::Never));
+    ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
+    bridge_core->start();
+
+    auto src_ep = endpoint_container->ref("n1-epSrc");
+    auto dst_ep = endpoint_container->ref("n1-epDst");
+    hakoniwa::pdu::PduKey key = {"Drone", "pos"};
+    const size_t pdu_size = src_ep->get_pdu_size(key);
+    auto counters = [&]() {
+        auto pdus = bridge_core->list_pdus("conn1");
+        EXPECT_TRUE(pdus.has_value() && pdus->size() == 1U);
+        return pdus->front();
+    };
+    auto publish = [&](uint8_t value) {
+        std::vector<std::byte> pdu_data(pdu_size, std::byte(value));
+        ASSERT_EQ(src_ep->send(key, pdu_data), HAKO_PDU_ERR_OK);
+    };
+
+    // Leading edge at 0 opens a window until 50 ms. A cycle at 40 ms finds
+    // nothing held back and schedules its next look an interval later.
+    publish(0x01);
+    time_source->advance_time(40000);
+    bridge_core->cyclic_trigger();
+    EXPECT_EQ(bridge_core->next_deadline_usec(), 90000U);
+
+    // A value held back at 45 ms moves the deadline to the window end.
+    time_source->advance_time(5000);
+    publish(0x02);
+    EXPECT_EQ(bridge_core->next_deadline_usec(), 50000U);
+
+    time_source->advance_time(5000);
+    bridge_core->cyclic_trigger();
+    EXPECT_EQ(counters().transfers.value_or(0), 2U);
+    EXPECT_EQ(counters().trailing_sends.value_or(0), 1U);
+    std::vector<std::byte> recv_pdu(pdu_size);
+    size_t received_size = 0;
+    ASSERT_EQ(dst_ep->recv(key, recv_pdu, received_size), HAKO_PDU_ERR_OK);
+    EXPECT_EQ(recv_pdu.front(), std::byte(0x02));
+}
+
+TEST(BridgeCoreFlowTest, LateJoinReplaysLatestValueToRestartedDestination) {
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
+        std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", config_path("endpoints.json"));
+    ASSERT_EQ(endpoint_container->initialize(), HAKO_PDU_ERR_OK) << endpoint_container->last_error();
+
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+    auto result = hakoniwa::pdu::bridge::build(
+        config_path("bridge-core-flow-late-join-test.json"), "node1", time_source, endpoint_container);
+    ASSERT_TRUE(result.ok()) << result.error_message;
+    auto bridge_core = std::move(result.core);
+    ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
+    bridge_core->start();
+
+    auto src_ep = endpoint_container->ref("n1-epSrc");
+    auto dst_ep = endpoint_container->ref("n1-epDst");
+    hakoniwa::pdu::PduKey key = {"Drone", "pos"};
+    const size_t pdu_size = src_ep->get_pdu_size(key);
+    auto publish = [&](uint8_t value) {
+        std::vector<std::byte> pdu_data(pdu_size, std::byte(value));
+        ASSERT_EQ(src_ep->send(key, pdu_data), HAKO_PDU_ERR_OK);
+    };
+    auto connection = [&]() {
+        auto conn = bridge_core->get_connection("conn1");
+        EXPECT_TRUE(conn.has_value());
+        return *conn;
+    };
+
+    publish(0x31);
+    bridge_core->cyclic_trigger(); // first poll: already running, not a join
+    EXPECT_EQ(connection().late_joins.value_or(99), 0U);
+
+    // The destination goes away and misses the next update.
+    ASSERT_EQ(dst_ep->stop(), HAKO_PDU_ERR_OK);
+    bridge_core->cyclic_trigger();
+    publish(0x32);
+
+    // On its return it gets the latest value at once, dedupe notwithstanding.
+    ASSERT_EQ(dst_ep->start(), HAKO_PDU_ERR_OK);
+    bridge_core->cyclic_trigger();
+    EXPECT_EQ(connection().late_joins.value_or(0), 1U);
+    EXPECT_EQ(connection().late_join_replays.value_or(0), 1U);
+    std::vector<std::byte> recv_pdu(pdu_size);
+    size_t received_size = 0;
+    ASSERT_EQ(dst_ep->recv(key, recv_pdu, received_size), HAKO_PDU_ERR_OK);
+    EXPECT_EQ(recv_pdu.front(), std::byte(0x32));
+
+    // Only once per join.
+    bridge_core->cyclic_trigger();
+    EXPECT_EQ(connection().late_join_replays.value_or(0), 1U);
+}
+
 TEST(BridgeCoreFlowTest, MonitorAttachDetachLifecycle) {
     std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
         std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", config_path("endpoints.json"));
@@ -539,4 +1029,136 @@ TEST(BridgeCoreFlowTest, MonitorMultipleSessionsCanSubscribeSimultaneously) {
     EXPECT_TRUE(monitor_runtime->list_monitor_infos().empty());
 }
 
+namespace {
+    const EndpointPollStats* find_poll_stats(const std::vector<EndpointPollStats>& stats, const std::string& endpoint_id) {
+        for (const auto& s : stats) {
+            if (s.endpoint_id == endpoint_id) {
+                return &s;
+            }
+        }
+        return nullptr;
+    }
+}
+
+TEST(BridgeCoreFlowTest, PollingSkipsEndpointsTheBridgeDoesNotRead) {
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
+        std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", config_path("endpoints.json"));
+    ASSERT_EQ(endpoint_container->initialize(), HAKO_PDU_ERR_OK);
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 0));
+
+    auto result = hakoniwa::pdu::bridge::build(config_path("bridge-core-flow-test.json"), "node1", time_source, endpoint_container);
+    ASSERT_TRUE(result.ok()) << result.error_message;
+    auto bridge_core = std::move(result.core);
+    ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
+    bridge_core->start();
+
+    for (int i = 0; i < 3; ++i) {
+        time_source->advance_time(1000);
+        ASSERT_TRUE(bridge_core->cyclic_trigger());
+    }
+    const auto stats = bridge_core->endpoint_poll_stats();
+    const auto* src = find_poll_stats(stats, "n1-epSrc");
+    const auto* dst = find_poll_stats(stats, "n1-epDst");
+    ASSERT_TRUE(src != nullptr);
+    ASSERT_TRUE(dst != nullptr);
+    EXPECT_TRUE(src->polled);
+    EXPECT_EQ(src->polls, 3U);
+    EXPECT_FALSE(dst->polled); // destination only
+    EXPECT_EQ(dst->polls, 0U);
+    EXPECT_EQ(bridge_core->next_deadline_usec(), 0U);
+}
+
+TEST(BridgeCoreFlowTest, WaitNextCycleIsPacedAndWokenByStop) {
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
+        std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", config_path("endpoints.json"));
+    ASSERT_EQ(endpoint_container->initialize(), HAKO_PDU_ERR_OK);
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 1000));
+
+    auto result = hakoniwa::pdu::bridge::build(config_path("bridge-core-flow-test.json"), "node1", time_source, endpoint_container);
+    ASSERT_TRUE(result.ok()) << result.error_message;
+    auto bridge_core = std::move(result.core);
+    ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
+    bridge_core->start();
+    time_source->advance_time(1000);
+    ASSERT_TRUE(bridge_core->cyclic_trigger());
+
+    // The source is polled every cycle, so the wait is one delta time.
+    ASSERT_EQ(bridge_core->next_deadline_usec(), 0U);
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(bridge_core->wait_next_cycle(kNoDeadline));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::microseconds(1000));
+
+    std::thread stopper([&bridge_core] { bridge_core->stop(); });
+    EXPECT_TRUE(bridge_core->wait_next_cycle(kNoDeadline)); // notified, before or during the wait
+    stopper.join();
+    EXPECT_FALSE(bridge_core->cyclic_trigger());
+}
+
+TEST(BridgeCoreFlowTest, EventLoopBacksOffIdlePolledEndpointsByDefault) {
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
+        std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", config_path("endpoints.json"));
+    ASSERT_EQ(endpoint_container->initialize(), HAKO_PDU_ERR_OK);
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 1000));
+
+    // No polling block: the fixed loop would poll the source every cycle.
+    auto result = hakoniwa::pdu::bridge::build(config_path("bridge-core-flow-test.json"), "node1", time_source, endpoint_container);
+    ASSERT_TRUE(result.ok()) << result.error_message;
+    auto bridge_core = std::move(result.core);
+    ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
+    bridge_core->start();
+
+    constexpr int kCycles = 100;
+    for (int i = 0; i < kCycles; ++i) {
+        time_source->advance_time(1000);
+        ASSERT_TRUE(bridge_core->cyclic_trigger());
+        (void)bridge_core->wait_next_cycle(0); // event-loop mode, without sleeping
+    }
+    const auto stats = bridge_core->endpoint_poll_stats();
+    const auto* src = find_poll_stats(stats, "n1-epSrc");
+    ASSERT_TRUE(src != nullptr);
+    // Idle for 10 ms, then the gap grows 1, 2, 4, 8 and stays at 10 ms.
+    EXPECT_EQ(src->interval_usec, kEventLoopMaxPollIntervalUsec);
+    EXPECT_LT(src->polls, 30U);
+    EXPECT_EQ(src->polls + src->idle_skips, static_cast<uint64_t>(kCycles));
+    EXPECT_GT(bridge_core->next_deadline_usec(), time_source->get_microseconds());
+}
+
+TEST(BridgeCoreFlowTest, PollingBacksOffIdleEndpoints) {
+    std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoint_container =
+        std::make_shared<hakoniwa::pdu::EndpointContainer>("node1", config_path("endpoints.json"));
+    ASSERT_EQ(endpoint_container->initialize(), HAKO_PDU_ERR_OK);
+    auto time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+        hakoniwa::time_source::create_time_source("virtual", 1000));
+
+    auto result = hakoniwa::pdu::bridge::build(config_path("bridge-core-flow-polling-test.json"), "node1", time_source, endpoint_container);
+    ASSERT_TRUE(result.ok()) << result.error_message;
+    auto bridge_core = std::move(result.core);
+    ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
+    bridge_core->start();
+
+    constexpr int kCycles = 500;
+    for (int i = 0; i < kCycles; ++i) {
+        time_source->advance_time(1000);
+        ASSERT_TRUE(bridge_core->cyclic_trigger());
+    }
+    const auto stats = bridge_core->endpoint_poll_stats();
+    const auto* src = find_poll_stats(stats, "n1-epSrc");
+    const auto* dst = find_poll_stats(stats, "n1-epDst");
+    ASSERT_TRUE(src != nullptr);
+    ASSERT_TRUE(dst != nullptr);
+    // No poll delivered an event: after 10 ms the gap grows 1, 2, 4 ... 80 ms.
+    EXPECT_EQ(src->interval_usec, 80000U);
+    EXPECT_LT(src->polls, 30U);
+    EXPECT_EQ(src->polls + src->idle_skips, static_cast<uint64_t>(kCycles));
+    EXPECT_EQ(dst->mode, EndpointPolling::Always);
+    EXPECT_EQ(dst->polls, static_cast<uint64_t>(kCycles));
+    // Always keeps the core due every cycle.
+    EXPECT_EQ(bridge_core->next_deadline_usec(), 0U);
+    ASSERT_TRUE(bridge_core->set_endpoint_polling("n1-epDst", EndpointPolling::Never));
+    EXPECT_GT(bridge_core->next_deadline_usec(), time_source->get_microseconds());
+}
+
 }
@@ -58,11 +58,26 @@ TEST(BridgeLoaderTest, LoadsTickerConfig) {
     EXPECT_EQ(config.transferPolicies.at("ticker_policy").type, "ticker");
     ASSERT_TRUE(config.transferPolicies.at("ticker_policy").intervalMs.has_value());
     EXPECT_EQ(*config.transferPolicies.at("ticker_policy").intervalMs, 50);
+    EXPECT_FALSE(config.transferPolicies.at("ticker_policy").phaseSpread.has_value());
     EXPECT_EQ(config.connections.front().transferPdus.front().policyId, "ticker_policy");
     ASSERT_TRUE(config.endpoints_config_path.has_value());
     EXPECT_EQ(*config.endpoints_config_path, "endpoints-ticker.json");
 }
 
+TEST(BridgeLoaderTest, LoadsTickerPhaseSpreadConfig) {
+    std::string error_message;
+    auto config_ = hakoniwa::pdu::bridge::parse(config_path("bridge-ticker-phase.json"), error_message);
+    ASSERT_TRUE(config_.has_value()) << error_message;
+    const auto& policy = config_->transferPolicies.at("ticker_policy");
+
+    EXPECT_EQ(policy.type, "ticker");
+    ASSERT_TRUE(policy.intervalMs.has_value());
+    EXPECT_EQ(*policy.intervalMs, 20);
+    ASSERT_TRUE(policy.phaseSpread.has_value());
+    EXPECT_TRUE(*policy.phaseSpread);
+    EXPECT_EQ(config_->pduKeyGroups.at("group1").size(), 2U);
+}
+
 TEST(BridgeLoaderTest, LoadsTickerConfig2) {
     std::string error_message;
     auto config_ = hakoniwa::pdu::bridge::parse(config_path("bridge-ticker2.json"), error_message);
@@ -0,0 +1,94 @@
+#include "hakoniwa/pdu/bridge/cycle_timing.hpp"
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+namespace hakoniwa::pdu::bridge::test {
+
+namespace {
+
+using Clock = CycleTiming::Clock;
+
+void record(CycleTiming& timing, Clock::time_point start, uint64_t cycle_usec)
+{
+    timing.begin(start);
+    timing.end(start + std::chrono::microseconds(cycle_usec));
+}
+
+} // namespace
+
+TEST(CycleTimingTest, CountsOverrunsAndFillsTheHistogram)
+{
+    CycleTiming timing(1000);
+    const auto t0 = Clock::now();
+    record(timing, t0, 10);      // < 16
+    record(timing, t0, 16);      // < 32
+    record(timing, t0, 999);     // < 1024
+    record(timing, t0, 1500);    // < 2048, overrun
+    record(timing, t0, 5000000); // open-ended, overrun
+    timing.end(t0);              // unmatched end is ignored
+
+    const auto stats = timing.stats();
+    EXPECT_EQ(stats.period_usec, 1000U);
+    EXPECT_EQ(stats.cycles, 5U);
+    EXPECT_EQ(stats.overruns, 2U);
+    EXPECT_EQ(stats.max_cycle_usec, 5000000U);
+    EXPECT_EQ(stats.mean_cycle_usec, (10U + 16U + 999U + 1500U + 5000000U) / 5U);
+    EXPECT_EQ(stats.max_jitter_usec, 0U); // never paced
+    ASSERT_EQ(stats.histogram.size(), kCycleHistogramBuckets);
+    EXPECT_EQ(stats.histogram[0], 1U);
+    EXPECT_EQ(stats.histogram[1], 1U);
+    EXPECT_EQ(stats.histogram[6], 1U);  // [512, 1024)
+    EXPECT_EQ(stats.histogram[7], 1U);  // [1024, 2048)
+    EXPECT_EQ(stats.histogram[kCycleHistogramBuckets - 1], 1U);
+}
+
+TEST(CycleTimingTest, ZeroPeriodNeverOverrunsOrSleeps)
+{
+    CycleTiming timing(0);
+    record(timing, Clock::now(), 100000);
+    const auto start = Clock::now();
+    timing.sleep_until_next_period();
+    EXPECT_LT(Clock::now() - start, std::chrono::milliseconds(50));
+    EXPECT_EQ(timing.stats().overruns, 0U);
+}
+
+TEST(CycleTimingTest, PacingDoesNotAddProcessingTimeToThePeriod)
+{
+    constexpr int kCycles = 20;
+    constexpr auto kPeriod = std::chrono::milliseconds(4);
+    CycleTiming timing(4000);
+    const auto start = Clock::now();
+    for (int i = 0; i < kCycles; ++i) {
+        timing.begin(Clock::now());
+        std::this_thread::sleep_for(std::chrono::milliseconds(2)); // the cycle's work
+        timing.end(Clock::now());
+        timing.sleep_until_next_period();
+    }
+    const auto elapsed = Clock::now() - start;
+    // A relative sleep would take kCycles * (work + period), about 120 ms.
+    EXPECT_GE(elapsed, kPeriod * kCycles);
+    EXPECT_LT(elapsed, kPeriod * kCycles + std::chrono::milliseconds(30)) << "slack for a loaded machine";
+    EXPECT_EQ(timing.stats().cycles, static_cast<uint64_t>(kCycles));
+}
+
+TEST(CycleTimingTest, FallingBehindRestartsTheSchedule)
+{
+    CycleTiming timing(20000);
+    timing.begin(Clock::now());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    timing.end(Clock::now());
+    // Past the boundary: return without a full-period sleep, and start the
+    // next cycle on a fresh schedule instead of bursting through the missed ones.
+    const auto before = Clock::now();
+    timing.sleep_until_next_period();
+    EXPECT_LT(Clock::now() - before, std::chrono::milliseconds(20));
+    timing.begin(Clock::now());
+    timing.end(Clock::now());
+    const auto stats = timing.stats();
+    EXPECT_EQ(stats.overruns, 1U);
+    EXPECT_LT(stats.max_jitter_usec, 20000U);
+}
+
+} // namespace hakoniwa::pdu::bridge::test
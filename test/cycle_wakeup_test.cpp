@@ -0,0 +1,48 @@
+#include "hakoniwa/pdu/bridge/cycle_clock.hpp"
+#include "hakoniwa/pdu/bridge/cycle_wakeup.hpp"
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+namespace hakoniwa::pdu::bridge::test {
+
+TEST(CycleWakeupTest, TimesOutWithoutNotification)
+{
+    CycleWakeup wakeup;
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(wakeup.wait_for_usec(2000));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::microseconds(2000));
+    EXPECT_FALSE(wakeup.wait_for_usec(0));
+}
+
+TEST(CycleWakeupTest, PendingNotificationEndsTheNextWait)
+{
+    CycleWakeup wakeup;
+    wakeup.notify();
+    wakeup.notify(); // coalesced with the first
+    EXPECT_TRUE(wakeup.wait_for_usec(kNoDeadline));
+    EXPECT_FALSE(wakeup.wait_for_usec(0)); // consumed
+    EXPECT_EQ(wakeup.notifications(), 2U);
+
+    wakeup.notify();
+    wakeup.clear();
+    EXPECT_FALSE(wakeup.wait_for_usec(0));
+}
+
+TEST(CycleWakeupTest, NotifyFromAnotherThreadWakesAWait)
+{
+    CycleWakeup wakeup;
+    for (int round = 0; round < 50; ++round) {
+        std::thread notifier([&wakeup] {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            wakeup.notify();
+        });
+        const auto start = std::chrono::steady_clock::now();
+        EXPECT_TRUE(wakeup.wait_for_usec(kNoDeadline));
+        EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+        notifier.join();
+    }
+}
+
+} // namespace hakoniwa::pdu::bridge::test
@@ -0,0 +1,83 @@
+#include "hakoniwa/pdu/bridge/cycle_worker_pool.hpp"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge::test {
+
+TEST(CycleWorkerPoolTest, SingleThreadRunsInline)
+{
+    CycleWorkerPool pool({});
+    EXPECT_EQ(pool.threads(), 1u);
+    const auto caller = std::this_thread::get_id();
+    std::vector<size_t> order;
+    pool.run(5, [&](size_t i) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        order.push_back(i);
+    });
+    EXPECT_EQ(order, (std::vector<size_t>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(pool.stats().tasks, 5u);
+    EXPECT_EQ(pool.stats().steals, 0u);
+}
+
+TEST(CycleWorkerPoolTest, EveryTaskRunsOncePerRun)
+{
+    CycleWorkerPool pool({4, {}});
+    EXPECT_EQ(pool.threads(), 4u);
+    for (size_t tasks : {0u, 1u, 3u, 4u, 17u, 1000u}) {
+        std::vector<std::atomic<int>> hits(tasks);
+        for (int round = 0; round < 20; ++round) {
+            pool.run(tasks, [&](size_t i) { hits[i].fetch_add(1); });
+            // run() is the barrier: every task of the round is done here.
+            for (size_t i = 0; i < tasks; ++i) {
+                ASSERT_EQ(hits[i].load(), round + 1) << "tasks=" << tasks << " i=" << i;
+            }
+        }
+    }
+}
+
+TEST(CycleWorkerPoolTest, IdleThreadsStealFromASlowRange)
+{
+    CycleWorkerPool pool({4, {}});
+    // Task 0 blocks until every other task has run. Its range-mates 1..3 then
+    // finish only if another thread steals them, or task 0 itself was stolen.
+    constexpr size_t kTasks = 16;
+    std::atomic<size_t> finished{0};
+    std::mutex mtx;
+    std::set<std::thread::id> runners;
+    pool.run(kTasks, [&](size_t i) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            runners.insert(std::this_thread::get_id());
+        }
+        if (i == 0) {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (finished.load() < kTasks - 1 && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::yield();
+            }
+        }
+        finished.fetch_add(1);
+    });
+    EXPECT_EQ(finished.load(), kTasks);
+    EXPECT_GT(runners.size(), 1u);
+    const auto stats = pool.stats();
+    EXPECT_EQ(stats.runs, 1u);
+    EXPECT_EQ(stats.tasks, kTasks);
+    EXPECT_GT(stats.steals, 0u);
+}
+
+TEST(CycleWorkerPoolTest, AffinityDoesNotBlockRuns)
+{
+    // CPU 0 exists everywhere; a failed pin only logs a warning.
+    CycleWorkerPool pool({2, {0, 0}});
+    std::atomic<size_t> count{0};
+    pool.run(8, [&](size_t) { count.fetch_add(1); });
+    EXPECT_EQ(count.load(), 8u);
+}
+
+} // namespace hakoniwa::pdu::bridge::test
@@ -0,0 +1,104 @@
+#include "hakoniwa/pdu/bridge/delta_codec.hpp"
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge::test {
+
+namespace {
+std::vector<std::byte> bytes_of(std::span<const std::byte> s)
+{
+    return std::vector<std::byte>(s.begin(), s.end());
+}
+std::vector<std::byte> make_frame(size_t size, uint8_t seed)
+{
+    std::vector<std::byte> frame(size);
+    for (size_t i = 0; i < size; ++i) {
+        frame[i] = std::byte(static_cast<uint8_t>(i * 31 + seed));
+    }
+    return frame;
+}
+} // namespace
+
+TEST(DeltaCodecTest, SmallChangesRoundTripAsDeltas) {
+    DeltaEncoder encoder(30);
+    DeltaDecoder decoder;
+    auto frame = make_frame(4096, 7);
+    for (int i = 0; i < 10; ++i) {
+        frame[(i * 613) % frame.size()] ^= std::byte(0xFF);
+        frame[frame.size() - 1] = std::byte(i);
+        auto wire = bytes_of(encoder.encode(frame));
+        if (i > 0) {
+            EXPECT_TRUE(is_delta_frame(wire));
+            EXPECT_LT(wire.size(), 64u);
+        }
+        std::span<const std::byte> decoded;
+        ASSERT_TRUE(decoder.decode(wire, decoded));
+        EXPECT_EQ(bytes_of(decoded), frame);
+    }
+    EXPECT_EQ(encoder.keyframes(), 1u);
+    EXPECT_EQ(encoder.deltas(), 9u);
+}
+
+TEST(DeltaCodecTest, KeyframeIntervalAndSizeChanges) {
+    DeltaEncoder encoder(3);
+    DeltaDecoder decoder;
+    const size_t sizes[] = {256, 300, 200, 256, 128, 512, 512};
+    for (size_t i = 0; i < std::size(sizes); ++i) {
+        auto frame = make_frame(sizes[i], 1);
+        auto wire = bytes_of(encoder.encode(frame));
+        std::span<const std::byte> decoded;
+        ASSERT_TRUE(decoder.decode(wire, decoded)) << "frame " << i;
+        EXPECT_EQ(bytes_of(decoded), frame) << "frame " << i;
+    }
+    EXPECT_EQ(encoder.keyframes(), 3u); // frames 0, 3 and 6
+}
+
+TEST(DeltaCodecTest, UnrelatedPayloadFallsBackToKeyframe) {
+    DeltaEncoder encoder(30);
+    (void)encoder.encode(make_frame(1024, 1));
+    auto other = make_frame(1024, 2);
+    auto wire = bytes_of(encoder.encode(other));
+    EXPECT_FALSE(is_delta_frame(wire));
+    EXPECT_EQ(wire, other);
+    EXPECT_EQ(encoder.keyframes(), 2u);
+}
+
+TEST(DeltaCodecTest, DeltaWithoutItsKeyframeIsDropped) {
+    DeltaEncoder encoder(30);
+    DeltaDecoder decoder;
+    auto frame = make_frame(1024, 3);
+    auto keyframe = bytes_of(encoder.encode(frame));
+    frame[10] ^= std::byte(1);
+    auto delta = bytes_of(encoder.encode(frame));
+    ASSERT_TRUE(is_delta_frame(delta));
+
+    std::span<const std::byte> decoded;
+    EXPECT_FALSE(decoder.decode(delta, decoded));
+    ASSERT_TRUE(decoder.decode(make_frame(1024, 4), decoded)); // some other keyframe
+    EXPECT_FALSE(decoder.decode(delta, decoded));
+    EXPECT_EQ(decoder.dropped(), 2u);
+
+    ASSERT_TRUE(decoder.decode(keyframe, decoded));
+    ASSERT_TRUE(decoder.decode(delta, decoded));
+    EXPECT_EQ(bytes_of(decoded), frame);
+}
+
+TEST(DeltaCodecTest, TruncatedDeltaIsRejected) {
+    DeltaEncoder encoder(30);
+    DeltaDecoder decoder;
+    auto frame = make_frame(1024, 5);
+    std::span<const std::byte> decoded;
+    ASSERT_TRUE(decoder.decode(bytes_of(encoder.encode(frame)), decoded));
+    for (size_t i = 0; i < 40; ++i) {
+        frame[i * 20] ^= std::byte(0x55);
+    }
+    auto delta = bytes_of(encoder.encode(frame));
+    ASSERT_TRUE(is_delta_frame(delta));
+    delta.resize(delta.size() - 1); // cuts into the last literal
+    EXPECT_FALSE(decoder.decode(delta, decoded));
+}
+
+} // namespace hakoniwa::pdu::bridge::test
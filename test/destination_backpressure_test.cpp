@@ -0,0 +1,62 @@
+#include "hakoniwa/pdu/bridge/destination_backpressure.hpp"
+#include <gtest/gtest.h>
+
+namespace hakoniwa::pdu::bridge::test {
+
+TEST(DestinationBackpressureTest, FailedSendCongestsAndProbesOncePerInterval)
+{
+    DestinationBackpressure bp("ws", BackpressureSettings{0, 1000});
+    EXPECT_TRUE(bp.admit(0));
+    bp.on_send(0, true, 50000); // slow, but slow_send_usec 0 only counts failures
+    EXPECT_FALSE(bp.congested());
+
+    bp.on_send(100, false, 10);
+    EXPECT_TRUE(bp.congested());
+    EXPECT_FALSE(bp.admit(500));
+    EXPECT_TRUE(bp.admit(1100)); // the probe
+    EXPECT_FALSE(bp.admit(1200));
+    bp.on_send(1100, false, 10); // probe failed; next one an interval later
+    EXPECT_FALSE(bp.admit(2000));
+    EXPECT_TRUE(bp.admit(2200));
+
+    const BackpressureStats stats = bp.stats();
+    EXPECT_TRUE(stats.congested);
+    EXPECT_EQ(stats.congestion_events, 1u);
+    EXPECT_EQ(stats.recoveries, 0u);
+}
+
+TEST(DestinationBackpressureTest, RecoveryIsReportedOnce)
+{
+    DestinationBackpressure bp("ws", BackpressureSettings{2000, 1000});
+    bp.on_send(0, true, 5000); // slower than 2 ms
+    ASSERT_TRUE(bp.congested());
+    EXPECT_FALSE(bp.recovery_pending());
+
+    ASSERT_TRUE(bp.admit(1000));
+    bp.on_send(1000, true, 100);
+    EXPECT_FALSE(bp.congested());
+    EXPECT_TRUE(bp.recovery_pending());
+    EXPECT_TRUE(bp.take_recovered());
+    EXPECT_FALSE(bp.take_recovered());
+    EXPECT_TRUE(bp.admit(1001));
+
+    const BackpressureStats stats = bp.stats();
+    EXPECT_FALSE(stats.congested);
+    EXPECT_EQ(stats.congestion_events, 1u);
+    EXPECT_EQ(stats.recoveries, 1u);
+}
+
+TEST(DestinationBackpressureTest, CountsSupersededAndFlushedValues)
+{
+    DestinationBackpressure bp("ws", BackpressureSettings{});
+    bp.note_coalesced(false); // first value held back
+    bp.note_coalesced(true);  // replaced by a newer one
+    bp.note_coalesced(true);
+    bp.note_flushed();
+
+    const BackpressureStats stats = bp.stats();
+    EXPECT_EQ(stats.coalesced_drops, 2u);
+    EXPECT_EQ(stats.flushed, 1u);
+}
+
+} // namespace hakoniwa::pdu::bridge::test
@@ -0,0 +1,96 @@
+#include "hakoniwa/pdu/bridge/epoch_domain.hpp"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge::test {
+
+namespace {
+
+struct Tracked {
+    explicit Tracked(int& destroyed) : destroyed_(destroyed) {}
+    ~Tracked() { ++destroyed_; }
+    int& destroyed_;
+};
+
+} // namespace
+
+TEST(EpochDomainTest, PinnedReaderKeepsRetiredObjectAlive)
+{
+    EpochDomain domain;
+    int destroyed = 0;
+    {
+        auto guard = domain.pin();
+        domain.retire(std::make_shared<Tracked>(destroyed));
+        EXPECT_EQ(domain.reclaim(), 1u);
+        EXPECT_EQ(destroyed, 0);
+    }
+    EXPECT_EQ(domain.reclaim(), 0u);
+    EXPECT_EQ(destroyed, 1);
+}
+
+TEST(EpochDomainTest, ReadersPinnedAfterRetireDoNotDelayReclaim)
+{
+    EpochDomain domain;
+    int first = 0;
+    int second = 0;
+    auto old_reader = domain.pin();
+    domain.retire(std::make_shared<Tracked>(first));
+    auto new_reader = domain.pin();
+    EXPECT_EQ(domain.reclaim(), 1u);
+
+    {
+        auto released = std::move(old_reader);
+    }
+    EXPECT_EQ(domain.reclaim(), 0u);
+    EXPECT_EQ(first, 1);
+
+    // new_reader pinned before this retire, so it still holds the second.
+    domain.retire(std::make_shared<Tracked>(second));
+    EXPECT_EQ(domain.reclaim(), 1u);
+    EXPECT_EQ(second, 0);
+}
+
+TEST(EpochDomainTest, PublishedObjectIsNeverFreedUnderAReader)
+{
+    struct Value {
+        explicit Value(int v) : value(v) {}
+        ~Value() { value = -1; }
+        int value;
+    };
+    EpochDomain domain;
+    std::shared_ptr<Value> owner = std::make_shared<Value>(0);
+    std::atomic<Value*> published{owner.get()};
+    std::atomic<bool> done{false};
+    std::atomic<int> bad{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&]() {
+            while (!done.load()) {
+                auto guard = domain.pin();
+                const Value* value = published.load(std::memory_order_seq_cst);
+                if (value->value < 0) {
+                    bad.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (int i = 1; i <= 20000; ++i) {
+        auto next = std::make_shared<Value>(i);
+        published.store(next.get(), std::memory_order_seq_cst);
+        domain.retire(std::exchange(owner, std::move(next)));
+        domain.reclaim();
+    }
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(bad.load(), 0);
+    EXPECT_EQ(domain.reclaim(), 0u);
+}
+
+} // namespace hakoniwa::pdu::bridge::test
@@ -0,0 +1,111 @@
+#include "hakoniwa/pdu/bridge/policy/immediate_policy.hpp"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge::test {
+
+namespace {
+
+std::shared_ptr<ImmediatePolicy> make_group(size_t members)
+{
+    auto policy = std::make_shared<ImmediatePolicy>(true);
+    for (size_t i = 0; i < members; ++i) {
+        EXPECT_EQ(policy->add_pdu_key({"Drone", static_cast<int>(i)}), i);
+    }
+    return policy;
+}
+
+} // namespace
+
+TEST(ImmediatePolicyTest, NonAtomicAlwaysTransfers)
+{
+    ImmediatePolicy policy(false);
+    EXPECT_EQ(policy.add_pdu_key({"Drone", 0}), ImmediatePolicy::kInvalidReadySlot);
+    EXPECT_TRUE(policy.should_transfer({"Drone", 0}, CycleContext{}));
+    EXPECT_TRUE(policy.mark_ready(ImmediatePolicy::kInvalidReadySlot));
+}
+
+TEST(ImmediatePolicyTest, LargeGroupCompletesOnLastMemberOnly)
+{
+    auto policy = make_group(300);
+    EXPECT_EQ(policy->group_size(), 300u);
+    EXPECT_EQ(policy->add_pdu_key({"Drone", 7}), 7u);
+    for (int round = 0; round < 3; ++round) {
+        for (size_t i = 0; i + 1 < 300; ++i) {
+            EXPECT_FALSE(policy->mark_ready(i));
+        }
+        EXPECT_FALSE(policy->mark_ready(5)); // repeats do not count twice
+        EXPECT_TRUE(policy->mark_ready(299));
+        policy->reset_ready();
+    }
+    EXPECT_FALSE(policy->mark_ready(300));
+}
+
+TEST(ImmediatePolicyTest, KeyAndSlotEntriesShareState)
+{
+    auto policy = make_group(2);
+    const CycleContext ctx{};
+    EXPECT_FALSE(policy->should_transfer({"Other", 0}, ctx));
+    EXPECT_FALSE(policy->mark_ready(0));
+    EXPECT_TRUE(policy->should_transfer({"Drone", 1}, ctx));
+    policy->on_transferred({"Drone", 1}, ctx);
+    EXPECT_FALSE(policy->should_transfer({"Drone", 1}, ctx));
+}
+
+TEST(ImmediatePolicyTest, ConcurrentMarksCompleteEachRoundExactlyOnce)
+{
+    constexpr size_t kMembers = 256;
+    constexpr size_t kThreads = 4;
+    constexpr int kRounds = 200;
+    auto policy = make_group(kMembers);
+    for (int round = 0; round < kRounds; ++round) {
+        std::atomic<int> completions{0};
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&policy, &completions, t]() {
+                for (size_t i = t; i < kMembers; i += kThreads) {
+                    if (policy->mark_ready(i)) {
+                        completions.fetch_add(1);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        ASSERT_EQ(completions.load(), 1);
+        policy->reset_ready();
+    }
+}
+
+TEST(ImmediatePolicyTest, MarkBeforeResetBelongsToConsumedRound)
+{
+    auto policy = make_group(2);
+    EXPECT_FALSE(policy->mark_ready(0));
+    EXPECT_TRUE(policy->mark_ready(1));
+    // A member arriving before the reset belongs to the consumed round.
+    EXPECT_FALSE(policy->mark_ready(0));
+    policy->reset_ready();
+    EXPECT_FALSE(policy->mark_ready(0));
+    EXPECT_TRUE(policy->mark_ready(1));
+}
+
+TEST(ImmediatePolicyTest, MemberReArrivingDuringGroupSendIsDropped)
+{
+    auto policy = make_group(3);
+    EXPECT_FALSE(policy->mark_ready(0));
+    EXPECT_FALSE(policy->mark_ready(1));
+    EXPECT_TRUE(policy->mark_ready(2));
+    // The group is being sent: member 2 arrives again before the reset.
+    EXPECT_FALSE(policy->mark_ready(2));
+    policy->reset_ready();
+    // Its arrival went with the reset, so the next round still needs it.
+    EXPECT_FALSE(policy->mark_ready(0));
+    EXPECT_FALSE(policy->mark_ready(1));
+    EXPECT_TRUE(policy->mark_ready(2));
+}
+
+} // namespace hakoniwa::pdu::bridge::test
@@ -0,0 +1,83 @@
+#include "hakoniwa/pdu/bridge/key_registry.hpp"
+#include "hakoniwa/pdu/bridge/policy/immediate_policy.hpp"
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge::test {
+
+TEST(KeyRegistryTest, InternsNamesToDenseStableIds)
+{
+    KeyRegistry keys;
+    const NameId drone = keys.intern("Drone");
+    const NameId pos = keys.intern("pos");
+    EXPECT_EQ(drone, 0u);
+    EXPECT_EQ(pos, 1u);
+    EXPECT_EQ(keys.intern(std::string("Drone")), drone);
+    EXPECT_EQ(keys.find("pos"), pos);
+    EXPECT_EQ(keys.find("missing"), kInvalidNameId);
+    EXPECT_EQ(keys.name(drone), "Drone");
+    EXPECT_EQ(keys.name(kInvalidNameId), "");
+
+    const PduKeyId key = keys.intern_pdu("Drone", "pos");
+    EXPECT_EQ(key, (PduKeyId{drone, pos}));
+    EXPECT_EQ(keys.find_pdu("Drone", "pos"), key);
+    EXPECT_EQ(keys.find_pdu("Drone", "missing"), PduKeyId{});
+    EXPECT_EQ(keys.label(key), "Drone.pos");
+    EXPECT_EQ(keys.size(), 2u);
+}
+
+TEST(KeyRegistryTest, ResolvedKeysAreSharedAndOutliveGrowth)
+{
+    KeyRegistry keys;
+    const NameId drone = keys.intern("Drone");
+    const auto& first = keys.resolved_key(drone, 3);
+    EXPECT_EQ(first.robot, "Drone");
+    EXPECT_EQ(first.channel_id, 3);
+    for (int i = 0; i < 1000; ++i) {
+        (void)keys.resolved_key(keys.intern("Robot" + std::to_string(i)), i);
+    }
+    EXPECT_EQ(&keys.resolved_key(drone, 3), &first);
+    EXPECT_EQ(first.robot, "Drone");
+    EXPECT_NE(&keys.resolved_key(drone, 4), &first);
+}
+
+TEST(KeyRegistryTest, ConcurrentInternAgreesOnIds)
+{
+    KeyRegistry keys;
+    constexpr int kNames = 200;
+    std::vector<std::vector<NameId>> seen(4);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < seen.size(); ++t) {
+        threads.emplace_back([&keys, &seen, t]() {
+            for (int i = 0; i < kNames; ++i) {
+                seen[t].push_back(keys.intern("pdu" + std::to_string(i)));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(keys.size(), static_cast<size_t>(kNames));
+    for (size_t t = 1; t < seen.size(); ++t) {
+        EXPECT_EQ(seen[t], seen[0]);
+    }
+}
+
+TEST(KeyRegistryTest, AtomicImmediatePolicyWaitsForEveryInternedMember)
+{
+    auto keys = std::make_shared<KeyRegistry>();
+    ImmediatePolicy policy(true, keys);
+    policy.add_pdu_key({"Drone", 1});
+    policy.add_pdu_key({"Drone", 2});
+    const CycleContext ctx{};
+    EXPECT_FALSE(policy.should_transfer({"Unknown", 1}, ctx));
+    EXPECT_FALSE(policy.should_transfer({"Drone", 1}, ctx));
+    EXPECT_TRUE(policy.should_transfer({"Drone", 2}, ctx));
+    policy.on_transferred({"Drone", 2}, ctx);
+    EXPECT_FALSE(policy.should_transfer({"Drone", 2}, ctx));
+}
+
+} // namespace hakoniwa::pdu::bridge::test
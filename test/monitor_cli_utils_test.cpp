@@ -18,18 +18,74 @@ TEST(MonitorCliUtilsTest, ControlApiResponseParsing)
     ASSERT_TRUE(health.has_value());
     EXPECT_TRUE(health->running);
     EXPECT_EQ(health->uptime_usec, 1234);
+    EXPECT_EQ(health->cycles, -1); // not reported
+    EXPECT_TRUE(health->cycle_histogram.empty());
+
+    const nlohmann::json timed_health_res = {
+        {"type", "health"},
+        {"health", {{"running", true}, {"uptime_usec", 1234}, {"last_error", ""},
+                    {"cycle", {{"period_usec", 1000}, {"cycles", 50}, {"overruns", 2},
+                               {"mean_cycle_usec", 120}, {"max_cycle_usec", 3000}, {"max_jitter_usec", 80},
+                               {"histogram", nlohmann::json::array({
+                                   {{"lt_usec", 128}, {"count", 48}},
+                                   {{"ge_usec", 1048576}, {"count", 2}}
+                               })}}}}}
+    };
+    const auto timed = monitor_cli::parse_health(timed_health_res);
+    ASSERT_TRUE(timed.has_value());
+    EXPECT_EQ(timed->period_usec, 1000);
+    EXPECT_EQ(timed->cycles, 50);
+    EXPECT_EQ(timed->overruns, 2);
+    EXPECT_EQ(timed->max_jitter_usec, 80);
+    ASSERT_EQ(timed->cycle_histogram.size(), 2U);
+    EXPECT_EQ(timed->cycle_histogram[0].lt_usec, 128);
+    EXPECT_EQ(timed->cycle_histogram[0].count, 48);
+    EXPECT_EQ(timed->cycle_histogram[1].lt_usec, -1);
+    EXPECT_EQ(timed->cycle_histogram[1].ge_usec, 1048576);
 
     const nlohmann::json connections_res = {
         {"type", "connections"},
         {"connections", nlohmann::json::array({
-            {{"connection_id", "conn1"}, {"node_id", "node1"}, {"active", true}, {"epoch", 2}, {"epoch_validation", true}}
+            {{"connection_id", "conn1"}, {"node_id", "node1"}, {"active", true}, {"epoch", 2}, {"epoch_validation", true}},
+            {{"connection_id", "conn2"}, {"node_id", "node1"}, {"active", true}, {"epoch", 0}, {"epoch_validation", false},
+             {"batch_frames", 10}, {"batched_pdus", 1000},
+             {"budget_bytes_per_sec", 100000}, {"budget_sent_bytes", 90000}, {"budget_utilization", 0.9},
+             {"budget_deferred", 4}, {"budget_dropped", 2},
+             {"async_queue_depth", 3}, {"async_queue_max_depth", 64}, {"async_sent", 900}, {"async_dropped", 5},
+             {"async_latency_avg_usec", 120}, {"async_latency_max_usec", 4000},
+             {"late_joins", 2}, {"late_join_replays", 30},
+             {"destinations", nlohmann::json::array({
+                 {{"endpoint_id", "ws"}, {"congested", true}, {"congestion_events", 2}, {"recoveries", 1},
+                  {"coalesced_drops", 40}, {"flushed", 3}}
+             })}}
         })}
     };
     const auto connections = monitor_cli::parse_connections(connections_res);
     ASSERT_TRUE(connections.has_value());
-    ASSERT_EQ(connections->size(), 1);
+    ASSERT_EQ(connections->size(), 2);
     EXPECT_EQ(connections->at(0).connection_id, "conn1");
     EXPECT_EQ(connections->at(0).epoch, 2);
+    EXPECT_EQ(connections->at(0).batch_frames, -1);
+    EXPECT_EQ(connections->at(1).batch_frames, 10);
+    EXPECT_EQ(connections->at(1).batched_pdus, 1000);
+    EXPECT_EQ(connections->at(0).budget_bytes_per_sec, -1);
+    EXPECT_EQ(connections->at(1).budget_bytes_per_sec, 100000);
+    EXPECT_DOUBLE_EQ(connections->at(1).budget_utilization, 0.9);
+    EXPECT_EQ(connections->at(1).budget_deferred, 4);
+    EXPECT_EQ(connections->at(1).budget_dropped, 2);
+    EXPECT_EQ(connections->at(0).async_sent, -1);
+    EXPECT_EQ(connections->at(1).async_queue_max_depth, 64);
+    EXPECT_EQ(connections->at(1).async_dropped, 5);
+    EXPECT_EQ(connections->at(1).async_latency_max_usec, 4000);
+    EXPECT_EQ(connections->at(0).late_joins, -1);
+    EXPECT_EQ(connections->at(1).late_joins, 2);
+    EXPECT_EQ(connections->at(1).late_join_replays, 30);
+    EXPECT_TRUE(connections->at(0).destinations.empty());
+    ASSERT_EQ(connections->at(1).destinations.size(), 1);
+    EXPECT_EQ(connections->at(1).destinations[0].endpoint_id, "ws");
+    EXPECT_TRUE(connections->at(1).destinations[0].congested);
+    EXPECT_EQ(connections->at(1).destinations[0].coalesced_drops, 40);
+    EXPECT_EQ(connections->at(1).destinations[0].flushed, 3);
 
     const nlohmann::json sessions_res = {
         {"type", "sessions"},
@@ -46,14 +102,32 @@ TEST(MonitorCliUtilsTest, ControlApiResponseParsing)
         {"type", "pdus"},
         {"connection_id", "conn1"},
         {"pdus", nlohmann::json::array({
-            {{"robot", "Drone"}, {"pdu_name", "pos"}, {"channel_id", 1}}
+            {{"robot", "Drone"}, {"pdu_name", "pos"}, {"channel_id", 1}},
+            {{"robot", "Drone"}, {"pdu_name", "points"}, {"channel_id", 2}, {"pdu_size", 65536}, {"max_received_size", 1200},
+             {"transfers", 50}, {"missed_ticks", 3}, {"unchanged_skips", 7}, {"dedupe_suppressed", 9}, {"trailing_sends", 4},
+             {"compressed_in_bytes", 4000}, {"compressed_out_bytes", 1000}, {"compress_usec", 12}, {"decompress_usec", 0}}
         })}
     };
     const auto pdus = monitor_cli::parse_pdus(pdus_res);
     ASSERT_TRUE(pdus.has_value());
-    ASSERT_EQ(pdus->size(), 1);
+    ASSERT_EQ(pdus->size(), 2);
     EXPECT_EQ(pdus->at(0).robot, "Drone");
     EXPECT_EQ(pdus->at(0).channel_id, 1);
+    EXPECT_EQ(pdus->at(0).pdu_size, -1);
+    EXPECT_EQ(pdus->at(1).pdu_size, 65536);
+    EXPECT_EQ(pdus->at(1).max_received_size, 1200);
+    EXPECT_EQ(pdus->at(0).transfers, -1);
+    EXPECT_EQ(pdus->at(1).transfers, 50);
+    EXPECT_EQ(pdus->at(1).missed_ticks, 3);
+    EXPECT_EQ(pdus->at(1).unchanged_skips, 7);
+    EXPECT_EQ(pdus->at(1).dedupe_suppressed, 9);
+    EXPECT_EQ(pdus->at(0).trailing_sends, -1);
+    EXPECT_EQ(pdus->at(1).trailing_sends, 4);
+    EXPECT_EQ(pdus->at(0).compressed_in_bytes, -1);
+    EXPECT_EQ(pdus->at(1).compressed_in_bytes, 4000);
+    EXPECT_EQ(pdus->at(1).compressed_out_bytes, 1000);
+    EXPECT_EQ(pdus->at(1).compress_usec, 12);
+    EXPECT_EQ(pdus->at(1).decompress_usec, 0);
 }
 
 TEST(MonitorCliUtilsTest, TailLineHasRobotChannelAndSize)
@@ -34,6 +34,7 @@ TEST(OnDemandControlHandlerTest, HealthAndSessionLifecycle) {
 
     ASSERT_EQ(endpoint_container->start_all(), HAKO_PDU_ERR_OK);
     core->start();
+    ASSERT_TRUE(core->cyclic_trigger());
 
     auto runtime = std::make_shared<BridgeMonitorRuntime>(core);
     OnDemandControlHandler handler(runtime);
@@ -43,6 +44,11 @@ TEST(OnDemandControlHandlerTest, HealthAndSessionLifecycle) {
     ASSERT_TRUE(health_res.contains("health"));
     ASSERT_TRUE(health_res.at("health").at("running").get<bool>());
     ASSERT_EQ(health_res.at("request_id"), "r1");
+    const auto& cycle = health_res.at("health").at("cycle");
+    EXPECT_EQ(cycle.at("period_usec").get<uint64_t>(), 1000U);
+    EXPECT_EQ(cycle.at("cycles").get<uint64_t>(), 1U);
+    ASSERT_EQ(cycle.at("histogram").size(), 1U);
+    EXPECT_EQ(cycle.at("histogram")[0].at("count").get<uint64_t>(), 1U);
 
     auto sub_res = handler.handle_request({
         {"type", "subscribe"},
@@ -0,0 +1,105 @@
+#include "hakoniwa/pdu/bridge/payload_compression.hpp"
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge::test {
+
+namespace {
+// Repetitive, like a mostly idle state array: compresses well.
+std::vector<std::byte> make_payload(size_t size)
+{
+    std::vector<std::byte> data(size, std::byte(0));
+    for (size_t i = 0; i < size; i += 64) {
+        data[i] = std::byte(static_cast<uint8_t>(i / 64));
+    }
+    return data;
+}
+std::vector<std::byte> bytes_of(std::span<const std::byte> s)
+{
+    return std::vector<std::byte>(s.begin(), s.end());
+}
+} // namespace
+
+TEST(PayloadCompressionTest, ParsesAlgorithmNames) {
+    EXPECT_EQ(parse_compression_algorithm("none"), CompressionAlgorithm::None);
+    EXPECT_EQ(parse_compression_algorithm("lz4"), CompressionAlgorithm::Lz4);
+    EXPECT_EQ(parse_compression_algorithm("zstd"), CompressionAlgorithm::Zstd);
+    EXPECT_FALSE(parse_compression_algorithm("gzip").has_value());
+    EXPECT_TRUE(compression_available(CompressionAlgorithm::None));
+}
+
+TEST(PayloadCompressionTest, NoneAndSmallPayloadsPassThrough) {
+    PduBytes scratch;
+    std::span<const std::byte> out;
+    auto data = make_payload(4096);
+    EXPECT_EQ(compress_payload(CompressionSettings{}, data, scratch, out), CompressResult::Raw);
+    EXPECT_EQ(out.data(), data.data());
+
+    CompressionSettings settings{CompressionAlgorithm::Zstd, 0, 8192};
+    EXPECT_EQ(compress_payload(settings, data, scratch, out), CompressResult::Raw); // below minBytes
+    EXPECT_EQ(out.data(), data.data());
+
+    // Raw payloads are forwarded untouched by the receiving side.
+    ASSERT_TRUE(decompress_payload(data, data.size(), scratch, out));
+    EXPECT_EQ(out.data(), data.data());
+}
+
+class PayloadCompressionRoundTrip : public ::testing::TestWithParam<CompressionAlgorithm> {};
+
+TEST_P(PayloadCompressionRoundTrip, CompressesAndRestores) {
+    if (!compression_available(GetParam())) {
+        GTEST_SKIP() << compression_algorithm_name(GetParam()) << " not built in";
+    }
+    CompressionSettings settings{GetParam(), 0, 256};
+    PduBytes scratch;
+    PduBytes restored;
+    auto data = make_payload(4096);
+    std::span<const std::byte> wire;
+    ASSERT_EQ(compress_payload(settings, data, scratch, wire), CompressResult::Compressed);
+    EXPECT_TRUE(is_compressed_frame(wire));
+    EXPECT_LT(wire.size(), data.size() / 4);
+
+    std::span<const std::byte> out;
+    ASSERT_TRUE(decompress_payload(wire, data.size(), restored, out));
+    EXPECT_EQ(bytes_of(out), data);
+
+    // Oversized and truncated frames are rejected.
+    EXPECT_FALSE(decompress_payload(wire, data.size() - 1, restored, out));
+    EXPECT_FALSE(decompress_payload(wire.first(wire.size() - 4), data.size(), restored, out));
+}
+
+TEST_P(PayloadCompressionRoundTrip, IncompressiblePayloadStaysRaw) {
+    if (!compression_available(GetParam())) {
+        GTEST_SKIP() << compression_algorithm_name(GetParam()) << " not built in";
+    }
+    std::vector<std::byte> data(1024);
+    uint32_t x = 12345;
+    for (auto& b : data) {
+        x = x * 1664525u + 1013904223u;
+        b = std::byte(static_cast<uint8_t>(x >> 24));
+    }
+    PduBytes scratch;
+    std::span<const std::byte> wire;
+    EXPECT_EQ(compress_payload(CompressionSettings{GetParam(), 0, 0}, data, scratch, wire), CompressResult::Raw);
+    EXPECT_EQ(wire.data(), data.data());
+}
+
+TEST_P(PayloadCompressionRoundTrip, MissingAlgorithmFailsWithRawFallback) {
+    if (compression_available(GetParam())) {
+        GTEST_SKIP() << compression_algorithm_name(GetParam()) << " is built in";
+    }
+    PduBytes scratch;
+    std::span<const std::byte> wire;
+    auto data = make_payload(4096);
+    EXPECT_EQ(compress_payload(CompressionSettings{GetParam(), 0, 256}, data, scratch, wire), CompressResult::Failed);
+    EXPECT_EQ(wire.data(), data.data());
+    EXPECT_EQ(wire.size(), data.size());
+}
+
+INSTANTIATE_TEST_SUITE_P(Algorithms, PayloadCompressionRoundTrip,
+                         ::testing::Values(CompressionAlgorithm::Lz4, CompressionAlgorithm::Zstd));
+
+} // namespace hakoniwa::pdu::bridge::test
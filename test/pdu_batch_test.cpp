@@ -0,0 +1,74 @@
+#include "hakoniwa/pdu/bridge/pdu_batch.hpp"
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge::test {
+
+namespace {
+// Builds a frame the way PduBatch lays it out.
+std::vector<std::byte> make_frame(const std::vector<std::tuple<std::string, int, std::vector<std::byte>>>& records)
+{
+    std::vector<std::byte> frame(sizeof(BatchHeader));
+    const BatchHeader header{BatchHeader::kMagic, static_cast<uint32_t>(records.size())};
+    std::memcpy(frame.data(), &header, sizeof(header));
+    for (const auto& [robot, channel, payload] : records) {
+        const BatchRecordHeader rec{channel, static_cast<uint32_t>(payload.size()), static_cast<uint32_t>(robot.size())};
+        const size_t offset = frame.size();
+        frame.resize(offset + sizeof(rec) + robot.size() + payload.size());
+        std::memcpy(frame.data() + offset, &rec, sizeof(rec));
+        std::memcpy(frame.data() + offset + sizeof(rec), robot.data(), robot.size());
+        std::memcpy(frame.data() + offset + sizeof(rec) + robot.size(), payload.data(), payload.size());
+    }
+    return frame;
+}
+} // namespace
+
+TEST(PduBatchTest, RecordsAreDeliveredInOrder) {
+    const auto frame = make_frame({
+        {"Drone1", 0, std::vector<std::byte>(16, std::byte(1))},
+        {"Drone2", 3, std::vector<std::byte>(48, std::byte(2))},
+    });
+    ASSERT_TRUE(is_batch_frame(frame));
+    std::vector<std::pair<std::string, int>> seen;
+    std::vector<size_t> sizes;
+    ASSERT_TRUE(for_each_batch_record(frame,
+        [&](const hakoniwa::pdu::PduResolvedKey& key, std::span<const std::byte> payload) {
+            seen.emplace_back(key.robot, key.channel_id);
+            sizes.push_back(payload.size());
+        }));
+    ASSERT_EQ(seen.size(), 2u);
+    EXPECT_EQ(seen[0], std::make_pair(std::string("Drone1"), 0));
+    EXPECT_EQ(seen[1], std::make_pair(std::string("Drone2"), 3));
+    EXPECT_EQ(sizes, (std::vector<size_t>{16, 48}));
+}
+
+TEST(PduBatchTest, MalformedFramesDeliverNothing) {
+    auto frame = make_frame({
+        {"Drone1", 0, std::vector<std::byte>(16, std::byte(1))},
+        {"Drone2", 1, std::vector<std::byte>(16, std::byte(2))},
+    });
+    int calls = 0;
+    auto count = [&](const hakoniwa::pdu::PduResolvedKey&, std::span<const std::byte>) { ++calls; };
+
+    auto truncated = frame;
+    truncated.resize(truncated.size() - 1);
+    EXPECT_FALSE(for_each_batch_record(truncated, count));
+
+    auto trailing = frame;
+    trailing.push_back(std::byte(0));
+    EXPECT_FALSE(for_each_batch_record(trailing, count));
+
+    auto not_batch = frame;
+    not_batch[0] = std::byte(0);
+    EXPECT_FALSE(is_batch_frame(not_batch));
+    EXPECT_FALSE(for_each_batch_record(not_batch, count));
+
+    EXPECT_EQ(calls, 0);
+}
+
+} // namespace hakoniwa::pdu::bridge::test
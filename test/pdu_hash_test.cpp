@@ -0,0 +1,34 @@
+#include "hakoniwa/pdu/bridge/pdu_hash.hpp"
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <set>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge::test {
+
+TEST(PduHashTest, EqualBytesHashEqual) {
+    std::vector<std::byte> a(72, std::byte(0x5A));
+    std::vector<std::byte> b(72, std::byte(0x5A));
+    EXPECT_EQ(hash_pdu_bytes(a), hash_pdu_bytes(b));
+}
+
+TEST(PduHashTest, SingleByteAndLengthChangesAreDetected) {
+    // Cover the block, word and tail paths of every length up to 100 bytes.
+    std::set<uint64_t> seen;
+    size_t count = 0;
+    for (size_t len = 0; len <= 100; ++len) {
+        std::vector<std::byte> data(len, std::byte(0));
+        seen.insert(hash_pdu_bytes(data));
+        ++count;
+        for (size_t i = 0; i < len; ++i) {
+            data[i] = std::byte(1);
+            seen.insert(hash_pdu_bytes(data));
+            ++count;
+            data[i] = std::byte(0);
+        }
+    }
+    EXPECT_EQ(seen.size(), count);
+}
+
+} // namespace hakoniwa::pdu::bridge::test
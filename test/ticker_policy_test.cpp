@@ -0,0 +1,86 @@
+#include "hakoniwa/pdu/bridge/policy/ticker_policy.hpp"
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace hakoniwa::pdu::bridge::test {
+
+namespace {
+
+const hakoniwa::pdu::PduResolvedKey kKey{"Drone", 0};
+
+CycleContext at(uint64_t now_usec)
+{
+    CycleContext ctx;
+    ctx.now_usec = now_usec;
+    return ctx;
+}
+
+// Drives the policy like TransferPdu does and returns the fire times.
+std::vector<uint64_t> run(TickerPolicy& policy, const std::vector<uint64_t>& cycles)
+{
+    std::vector<uint64_t> fired;
+    for (uint64_t now : cycles) {
+        if (policy.should_transfer(kKey, at(now))) {
+            policy.on_transferred(kKey, at(now));
+            fired.push_back(now);
+        }
+    }
+    return fired;
+}
+
+// 20 ms cycles where every other cycle runs 1 ms late.
+std::vector<uint64_t> jittered_cycles()
+{
+    std::vector<uint64_t> cycles{0};
+    for (uint64_t i = 1; i <= 10; ++i) {
+        cycles.push_back(i * 20000 + (i % 2 ? 1000 : 0));
+    }
+    return cycles;
+}
+
+} // namespace
+
+TEST(TickerPolicyTest, FixedDelayDriftsWithLateCycles) {
+    TickerPolicy policy(20000);
+    const auto fired = run(policy, jittered_cycles());
+    // Each late fire pushes the next tick past the following cycle.
+    EXPECT_EQ(fired.size(), 5U);
+    EXPECT_EQ(policy.missed_ticks(), 0U);
+}
+
+TEST(TickerPolicyTest, FixedRateKeepsConfiguredRate) {
+    TickerSchedule schedule;
+    schedule.fixed_rate = true;
+    TickerPolicy policy(20000, 0, schedule);
+    const auto fired = run(policy, jittered_cycles());
+    EXPECT_EQ(fired.size(), 10U);
+    EXPECT_EQ(policy.next_deadline_usec(), 11U * 20000);
+    EXPECT_EQ(policy.missed_ticks(), 0U);
+}
+
+TEST(TickerPolicyTest, FixedRateSkipDropsMissedTicks) {
+    TickerSchedule schedule;
+    schedule.fixed_rate = true;
+    TickerPolicy policy(10000, 0, schedule);
+    // Armed at 0; the cycle at 45 ms owes ticks 10, 20, 30, 40.
+    const auto fired = run(policy, {0, 45000, 50000});
+    EXPECT_EQ(fired, (std::vector<uint64_t>{45000, 50000}));
+    EXPECT_EQ(policy.missed_ticks(), 3U);
+}
+
+TEST(TickerPolicyTest, FixedRateBurstSendsOwedTicks) {
+    TickerSchedule schedule;
+    schedule.fixed_rate = true;
+    schedule.catch_up = TickerCatchUp::Burst;
+    schedule.max_burst = 2;
+    TickerPolicy policy(10000, 0, schedule);
+    // Ticks 10..40 owed at 45 ms: two are kept (30, 40), then caught up at
+    // 46 ms before the 50 ms tick is served on schedule.
+    const auto fired = run(policy, {0, 45000, 46000, 47000, 50000});
+    EXPECT_EQ(fired, (std::vector<uint64_t>{45000, 46000, 50000}));
+    EXPECT_EQ(policy.missed_ticks(), 2U);
+}
+
+} // namespace hakoniwa::pdu::bridge::test
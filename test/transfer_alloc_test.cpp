@@ -0,0 +1,225 @@
+#include "hakoniwa/pdu/bridge/bridge_builder.hpp"
+#include "hakoniwa/pdu/bridge/bridge_core.hpp"
+#include "hakoniwa/pdu/endpoint.hpp"
+#include "hakoniwa/time_source/time_source_factory.hpp"
+#include "hakoniwa/time_source/virtual_time_source.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+/*
+ * Global allocation hook. It only counts while a measurement window is open;
+ * outside of it this is a plain malloc/free forwarder.
+ */
+namespace {
+    std::atomic<bool> g_count_allocations{false};
+    std::atomic<size_t> g_allocation_count{0};
+
+    void* counted_alloc(std::size_t size, std::size_t alignment)
+    {
+        if (g_count_allocations.load(std::memory_order_relaxed)) {
+            g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (size == 0) {
+            size = 1;
+        }
+        void* p = nullptr;
+        if (alignment <= alignof(std::max_align_t)) {
+            p = std::malloc(size);
+        }
+        else {
+            size = (size + alignment - 1) / alignment * alignment;
+            p = std::aligned_alloc(alignment, size);
+        }
+        if (!p) {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+}
+
+void* operator new(std::size_t size) { return counted_alloc(size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t size) { return counted_alloc(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, std::align_val_t al) { return counted_alloc(size, static_cast<std::size_t>(al)); }
+void* operator new[](std::size_t size, std::align_val_t al) { return counted_alloc(size, static_cast<std::size_t>(al)); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace hakoniwa::pdu::bridge::test {
+
+namespace {
+    std::filesystem::path test_config_root() {
+        if (const char* config_dir = std::getenv("HAKO_TEST_CONFIG_DIR"); config_dir && *config_dir) {
+            return std::filesystem::path(config_dir);
+        }
+        return std::filesystem::path(TEST_CONFIG_DIR);
+    }
+
+    std::string config_path(const std::string& filename, const std::string& subdir) {
+        return (test_config_root() / subdir / filename).string();
+    }
+
+    class AllocationWindow {
+    public:
+        AllocationWindow()
+        {
+            g_allocation_count.store(0, std::memory_order_relaxed);
+            g_count_allocations.store(true, std::memory_order_relaxed);
+        }
+        ~AllocationWindow() { close(); }
+        size_t close()
+        {
+            g_count_allocations.store(false, std::memory_order_relaxed);
+            return g_allocation_count.load(std::memory_order_relaxed);
+        }
+    };
+
+    constexpr int kWarmupCycles = 8;
+    constexpr int kMeasuredCycles = 64;
+
+    // Runs cycle through a warm-up, then counts the allocations of the measured cycles.
+    template <typename Cycle>
+    size_t count_allocations(Cycle&& cycle)
+    {
+        for (int i = 0; i < kWarmupCycles; ++i) {
+            cycle();
+        }
+        AllocationWindow window;
+        for (int i = 0; i < kMeasuredCycles; ++i) {
+            cycle();
+        }
+        return window.close();
+    }
+
+    struct AllocFixture {
+        std::shared_ptr<hakoniwa::pdu::EndpointContainer> endpoints;
+        std::shared_ptr<hakoniwa::time_source::VirtualTimeSource> time_source;
+        std::unique_ptr<BridgeCore> core;
+    };
+
+    // The endpoints have no comm and keep only the latest value per PDU, so once
+    // warm they do not allocate; whatever the window counts is the bridge's.
+    void build_fixture(const std::string& bridge_file, AllocFixture& out)
+    {
+        out.endpoints = std::make_shared<hakoniwa::pdu::EndpointContainer>(
+            "node1", config_path("endpoints.json", "transfer_alloc"));
+        ASSERT_EQ(out.endpoints->initialize(), HAKO_PDU_ERR_OK) << out.endpoints->last_error();
+        out.time_source = std::static_pointer_cast<hakoniwa::time_source::VirtualTimeSource>(
+            hakoniwa::time_source::create_time_source("virtual", 0));
+        auto result = hakoniwa::pdu::bridge::build(config_path(bridge_file, "transfer_alloc"), "node1",
+                                                   out.time_source, out.endpoints);
+        ASSERT_TRUE(result.ok()) << result.error_message;
+        out.core = std::move(result.core);
+        ASSERT_EQ(out.endpoints->start_all(), HAKO_PDU_ERR_OK);
+    }
+}
+
+/*
+ * The bridge data path must not allocate on its own. The endpoint calls a
+ * cycle makes are first issued by hand to show that the endpoints themselves
+ * allocate nothing; the bridged cycle must then add nothing either.
+ */
+TEST(TransferAllocTest, SteadyStateFanoutAddsNoAllocations) {
+    AllocFixture fx;
+    ASSERT_NO_FATAL_FAILURE(build_fixture("bridge.json", fx));
+
+    auto src1_ep = fx.endpoints->ref("src1");
+    auto dst1_ep = fx.endpoints->ref("dst1");
+    auto dst2_ep = fx.endpoints->ref("dst2");
+    hakoniwa::pdu::PduKey key1 = {"TestRobot", "pdu1"};
+    std::vector<std::byte> pdu_data(16, std::byte(0x11));
+    std::vector<std::byte> recv_buffer(16);
+
+    // The endpoint calls one bridge cycle issues, done by hand.
+    const size_t endpoint_allocs = count_allocations([&]() {
+        size_t received_size = 0;
+        bool running = false;
+        (void)src1_ep->send(key1, pdu_data);
+        (void)src1_ep->recv(key1, recv_buffer, received_size);
+        for (const auto& dst : {dst1_ep, dst2_ep}) {
+            (void)dst->is_running(running);
+            (void)dst->send(key1, std::span<const std::byte>(recv_buffer.data(), received_size));
+        }
+    });
+    ASSERT_EQ(endpoint_allocs, 0u) << "the stub endpoints allocate; bridge allocations cannot be isolated";
+
+    fx.core->start();
+    const size_t bridged_extra = count_allocations([&]() {
+        pdu_data.front() = std::byte(static_cast<uint8_t>(pdu_data.front()) + 1);
+        (void)src1_ep->send(key1, pdu_data);
+        fx.time_source->advance_time(10000);
+        fx.core->cyclic_trigger();
+    }) - endpoint_allocs;
+    EXPECT_EQ(bridged_extra, 0u);
+
+    // Sanity: the bridge really moved data during the window.
+    size_t received_size = 0;
+    ASSERT_EQ(dst2_ep->recv(key1, recv_buffer, received_size), HAKO_PDU_ERR_OK);
+    EXPECT_EQ(received_size, pdu_data.size());
+    EXPECT_EQ(recv_buffer.front(), pdu_data.front());
+}
+
+/*
+ * An atomic group staged from the source snapshot and written member by
+ * member must not allocate either, once its staging buffers are warm.
+ */
+TEST(TransferAllocTest, SteadyStateAtomicGroupAddsNoAllocations) {
+    AllocFixture fx;
+    ASSERT_NO_FATAL_FAILURE(build_fixture("bridge-atomic.json", fx));
+
+    auto src_ep = fx.endpoints->ref("atomic_src");
+    auto dst_ep = fx.endpoints->ref("atomic_dst");
+    const std::vector<hakoniwa::pdu::PduKey> keys = {
+        {"Test", "pdu1"}, {"Test", "pdu2"}, {"Test", "pdu3"}, {"SimTime", "pdu"}};
+    std::vector<std::vector<std::byte>> frames;
+    for (const auto& key : keys) {
+        frames.emplace_back(src_ep->get_pdu_size(key), std::byte(0x22));
+    }
+    std::vector<std::byte> recv_buffer(128);
+    uint8_t sequence = 0;
+    auto publish_group = [&]() {
+        ++sequence;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            frames[i].front() = std::byte(sequence);
+            (void)src_ep->send(keys[i], frames[i]);
+        }
+    };
+
+    const size_t endpoint_allocs = count_allocations([&]() {
+        bool running = false;
+        publish_group();
+        for (const auto& key : keys) {
+            size_t received_size = 0;
+            (void)src_ep->recv(key, recv_buffer, received_size);
+            (void)dst_ep->is_running(running);
+            (void)dst_ep->send(key, std::span<const std::byte>(recv_buffer.data(), received_size));
+        }
+    });
+    ASSERT_EQ(endpoint_allocs, 0u) << "the stub endpoints allocate; bridge allocations cannot be isolated";
+
+    fx.core->start();
+    const size_t bridged_extra = count_allocations([&]() {
+        publish_group();
+        fx.time_source->advance_time(10000);
+        fx.core->cyclic_trigger();
+    }) - endpoint_allocs;
+    EXPECT_EQ(bridged_extra, 0u);
+
+    // Sanity: the last group was delivered during the window.
+    size_t received_size = 0;
+    ASSERT_EQ(dst_ep->recv(keys.back(), recv_buffer, received_size), HAKO_PDU_ERR_OK);
+    EXPECT_EQ(recv_buffer.front(), std::byte(sequence));
+}
+
+} // namespace hakoniwa::pdu::bridge::test
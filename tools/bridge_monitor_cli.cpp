@@ -301,6 +301,25 @@ void print_health(const json& res)
         << "  uptime_usec: " << health->uptime_usec << "\n"
         << "  last_error: \"" << health->last_error << "\""
         << std::endl;
+    if (health->cycles < 0) {
+        return;
+    }
+    std::cout
+        << "  period_usec: " << health->period_usec << "\n"
+        << "  cycles: " << health->cycles << "\n"
+        << "  overruns: " << health->overruns << "\n"
+        << "  mean_cycle_usec: " << health->mean_cycle_usec << "\n"
+        << "  max_cycle_usec: " << health->max_cycle_usec << "\n"
+        << "  max_jitter_usec: " << health->max_jitter_usec << "\n"
+        << "  cycle_histogram:";
+    for (const auto& bucket : health->cycle_histogram) {
+        if (bucket.lt_usec >= 0) {
+            std::cout << " <" << bucket.lt_usec << "us=" << bucket.count;
+        } else {
+            std::cout << " >=" << bucket.ge_usec << "us=" << bucket.count;
+        }
+    }
+    std::cout << std::endl;
 }
 
 void print_connections(const json& res)
@@ -317,8 +336,35 @@ void print_connections(const json& res)
             << ", node_id: " << c.node_id
             << ", active: " << c.active
             << ", epoch: " << c.epoch
-            << ", epoch_validation: " << c.epoch_validation
-            << std::endl;
+            << ", epoch_validation: " << c.epoch_validation;
+        if (c.batch_frames >= 0) {
+            std::cout << ", batch_frames: " << c.batch_frames << ", batched_pdus: " << c.batched_pdus;
+        }
+        if (c.budget_bytes_per_sec >= 0) {
+            std::cout << ", budget_bytes_per_sec: " << c.budget_bytes_per_sec
+                      << ", budget_utilization: " << c.budget_utilization
+                      << ", budget_deferred: " << c.budget_deferred
+                      << ", budget_dropped: " << c.budget_dropped;
+        }
+        if (c.async_sent >= 0) {
+            std::cout << ", async_queue_depth: " << c.async_queue_depth << "/" << c.async_queue_max_depth
+                      << ", async_sent: " << c.async_sent
+                      << ", async_dropped: " << c.async_dropped
+                      << ", async_latency_usec: " << c.async_latency_avg_usec << " avg / " << c.async_latency_max_usec << " max";
+        }
+        if (c.late_joins >= 0) {
+            std::cout << ", late_joins: " << c.late_joins << ", late_join_replays: " << c.late_join_replays;
+        }
+        std::cout << std::endl;
+        for (const auto& d : c.destinations) {
+            std::cout
+                << "    destination: " << d.endpoint_id
+                << ", congested: " << d.congested
+                << ", congestion_events: " << d.congestion_events
+                << ", recoveries: " << d.recoveries
+                << ", coalesced_drops: " << d.coalesced_drops
+                << ", flushed: " << d.flushed << std::endl;
+        }
     }
 }
 
@@ -353,8 +399,38 @@ void print_pdus(const json& res)
             << "- connection_id: " << p.connection_id
             << ", robot: " << p.robot
             << ", pdu_name: " << p.pdu_name
-            << ", channel_id: " << p.channel_id
-            << std::endl;
+            << ", channel_id: " << p.channel_id;
+        if (p.pdu_size >= 0) {
+            std::cout << ", pdu_size: " << p.pdu_size;
+        }
+        if (p.max_received_size >= 0) {
+            std::cout << ", max_received_size: " << p.max_received_size;
+        }
+        if (p.transfers >= 0) {
+            std::cout << ", transfers: " << p.transfers;
+        }
+        if (p.missed_ticks >= 0) {
+            std::cout << ", missed_ticks: " << p.missed_ticks;
+        }
+        if (p.unchanged_skips >= 0) {
+            std::cout << ", unchanged_skips: " << p.unchanged_skips;
+        }
+        if (p.dedupe_suppressed >= 0) {
+            std::cout << ", dedupe_suppressed: " << p.dedupe_suppressed;
+        }
+        if (p.trailing_sends > 0) {
+            std::cout << ", trailing_sends: " << p.trailing_sends;
+        }
+        // Compression figures only mean something once payloads went through it.
+        if (p.compressed_in_bytes > 0 && p.compressed_out_bytes >= 0) {
+            std::cout << ", compression_ratio: "
+                      << static_cast<double>(p.compressed_out_bytes) / static_cast<double>(p.compressed_in_bytes)
+                      << ", compress_usec: " << p.compress_usec;
+        }
+        if (p.decompress_usec > 0) {
+            std::cout << ", decompress_usec: " << p.decompress_usec;
+        }
+        std::cout << std::endl;
     }
 }
 